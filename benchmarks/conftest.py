@@ -0,0 +1,124 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+"""Shared fixtures for the pytest benchmarks.
+
+The suite uses the ``benchmark`` fixture of `pytest-benchmark`. When the plugin is not
+installed, a minimal replacement based on :py:func:`time.perf_counter` is used instead
+and the results are printed at the end of the session.
+"""
+
+from __future__ import annotations
+
+import statistics
+import time
+from typing import Any, Callable, Iterator
+
+import pytest
+
+from pyhwloc import Topology
+from pyhwloc.distances import Distances
+from pyhwloc.synthetic import add_numa_distances
+
+# Synthetic topologies of increasing size. The number of PUs is 2, 32, 256 and 16384.
+SIZES = {
+    "tiny": "pack:1 core:2 pu:2",
+    "small": "pack:2 numa:2 l3:2 core:4 pu:2",
+    "medium": "pack:4 numa:4 l3:4 core:8 pu:2",
+    "large": "pack:16 numa:4 l3:8 core:16 pu:2",
+}
+
+
+@pytest.fixture(scope="module", params=list(SIZES))
+def synthetic_desc(request: pytest.FixtureRequest) -> str:
+    """Description of a synthetic topology, see :py:data:`SIZES`."""
+    return SIZES[request.param]
+
+
+@pytest.fixture(scope="module")
+def synthetic(synthetic_desc: str) -> Iterator[Topology]:
+    """A loaded synthetic topology with a NUMA latency matrix if it has more than one
+    NUMA node."""
+    with Topology.from_synthetic(synthetic_desc, load=True) as topo:
+        if topo.n_numa_nodes() > 1:
+            add_numa_distances(topo)
+        yield topo
+
+
+@pytest.fixture
+def numa_distances(synthetic: Topology) -> Iterator[Distances]:
+    """The NUMA latency matrix of the synthetic topology."""
+    distances = synthetic.get_distances()
+    if not distances:
+        pytest.skip("Single NUMA node.")
+    (dist,) = distances
+    yield dist
+    dist.release()
+
+
+try:
+    import pytest_benchmark  # noqa: F401
+except ImportError:
+    _RESULTS: list[tuple[str, list[float], dict[str, Any]]] = []
+
+    class _Benchmark:
+        """Subset of the pytest-benchmark fixture."""
+
+        MIN_ROUNDS = 5
+        MAX_ROUNDS = 10000
+        MAX_TIME = 0.5
+        """Stop the calibration after this many seconds."""
+
+        def __init__(self, name: str) -> None:
+            self.name = name
+            self.extra_info: dict[str, Any] = {}
+
+        def __call__(self, target: Callable, *args: Any, **kwargs: Any) -> Any:
+            results: list[float] = []
+            begin = time.perf_counter()
+            while len(results) < self.MIN_ROUNDS or (
+                len(results) < self.MAX_ROUNDS
+                and time.perf_counter() - begin < self.MAX_TIME
+            ):
+                start = time.perf_counter()
+                result = target(*args, **kwargs)
+                results.append(time.perf_counter() - start)
+            _RESULTS.append((self.name, results, self.extra_info))
+            return result
+
+        def pedantic(
+            self,
+            target: Callable,
+            args: tuple = (),
+            kwargs: dict | None = None,
+            setup: Callable | None = None,
+            rounds: int = 1,
+            warmup_rounds: int = 0,
+            iterations: int = 1,
+        ) -> Any:
+            results: list[float] = []
+            for i in range(warmup_rounds + rounds):
+                if setup is not None:
+                    args, kwargs = setup() or (args, kwargs)
+                start = time.perf_counter()
+                for _ in range(iterations):
+                    result = target(*args, **(kwargs or {}))
+                if i >= warmup_rounds:
+                    results.append((time.perf_counter() - start) / iterations)
+            _RESULTS.append((self.name, results, self.extra_info))
+            return result
+
+    @pytest.fixture
+    def benchmark(request: pytest.FixtureRequest) -> _Benchmark:
+        return _Benchmark(request.node.name)
+
+    def pytest_terminal_summary(terminalreporter: Any) -> None:
+        if not _RESULTS:
+            return
+        terminalreporter.section("benchmarks (install pytest-benchmark for details)")
+        width = max(len(name) for name, _, _ in _RESULTS)
+        for name, results, extra_info in _RESULTS:
+            extra = "".join(f", {k}: {v:.6g}" for k, v in extra_info.items())
+            terminalreporter.write_line(
+                f"{name:<{width}} median: {statistics.median(results) * 1e6:12.3f} us, "
+                f"min: {min(results) * 1e6:12.3f} us, rounds: {len(results)}{extra}"
+            )
@@ -0,0 +1,59 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+"""
+Benchmark for pickling topologies
+=================================
+
+Measure the pickle round-trip time of the current system's topology, as done when
+shipping a topology to many worker processes.
+
+.. code-block:: sh
+
+    python benchmarks/pickle_topology.py --repeat 100 --strip-io
+"""
+
+from __future__ import annotations
+
+import argparse
+import pickle
+import statistics
+import time
+
+from pyhwloc import Topology
+from pyhwloc.topology import TypeFilter
+
+
+def main(args: argparse.Namespace) -> None:
+    with Topology.from_this_system().set_io_types_filter(TypeFilter.KEEP_ALL) as topo:
+        topo.set_pickle_options(strip_io=args.strip_io)
+
+        start = time.perf_counter()
+        data = pickle.dumps(topo)
+        first = (time.perf_counter() - start) * 1000
+
+        dumps, loads = [], []
+        for _ in range(args.repeat):
+            start = time.perf_counter()
+            data = pickle.dumps(topo)
+            dumps.append((time.perf_counter() - start) * 1000)
+
+            start = time.perf_counter()
+            restored = pickle.loads(data)
+            loads.append((time.perf_counter() - start) * 1000)
+            restored.destroy()
+
+    print(f"size: {len(data)} bytes")
+    print(f"first dumps: {first:8.3f} ms")
+    print(f"dumps median: {statistics.median(dumps):8.3f} ms")
+    print(f"loads median: {statistics.median(loads):8.3f} ms")
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--repeat", type=int, default=20)
+    parser.add_argument(
+        "--strip-io",
+        action="store_true",
+        help="Remove IO and Misc objects from the pickled topology.",
+    )
+    main(parser.parse_args())
@@ -0,0 +1,60 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+"""Benchmarks for the cost of the binding system calls on this system, including the
+conversion of the targets done by the Python layer."""
+
+from __future__ import annotations
+
+import threading
+from typing import Any, Iterator
+
+import pytest
+
+from pyhwloc import Topology
+from pyhwloc.topology import CpuBindFlags, MemBindFlags, MemBindPolicy
+
+
+@pytest.fixture(scope="module")
+def topo() -> Iterator[Topology]:
+    with Topology.from_this_system(load=True) as topo:
+        cpubind = topo.get_cpubind()
+        membind, policy = topo.get_membind(MemBindFlags.BYNODESET)
+        yield topo
+        topo.set_cpubind(cpubind)
+        topo.set_membind(membind, policy, MemBindFlags.BYNODESET)
+
+
+def test_get_cpubind(benchmark: Any, topo: Topology) -> None:
+    benchmark(topo.get_cpubind)
+
+
+@pytest.mark.parametrize("target", ["bitmap", "object", "set"])
+def test_set_cpubind(benchmark: Any, topo: Topology, target: str) -> None:
+    pu = next(topo.iter_cpus())
+    cpuset = pu.cpuset
+    assert cpuset is not None
+    arg = {"bitmap": cpuset, "object": pu, "set": cpuset.to_sched_set()}[target]
+    benchmark(topo.set_cpubind, arg)
+
+
+def test_set_thread_cpubind(benchmark: Any, topo: Topology) -> None:
+    cpuset = topo.allowed_cpuset
+    benchmark(topo.set_thread_cpubind, threading.get_ident(), cpuset)
+
+
+def test_set_cpubind_thread_flag(benchmark: Any, topo: Topology) -> None:
+    benchmark(topo.set_cpubind, topo.allowed_cpuset, CpuBindFlags.THREAD)
+
+
+def test_get_last_cpu_location(benchmark: Any, topo: Topology) -> None:
+    benchmark(topo.get_last_cpu_location)
+
+
+def test_get_membind(benchmark: Any, topo: Topology) -> None:
+    benchmark(topo.get_membind, MemBindFlags.BYNODESET)
+
+
+@pytest.mark.parametrize("policy", [MemBindPolicy.BIND, MemBindPolicy.INTERLEAVE])
+def test_set_membind(benchmark: Any, topo: Topology, policy: MemBindPolicy) -> None:
+    node = next(topo.iter_numa_nodes())
+    benchmark(topo.set_membind, node, policy)
@@ -0,0 +1,74 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+"""Benchmarks for bitmap operations on the cpusets of synthetic topologies."""
+
+from __future__ import annotations
+
+from typing import Any
+
+import pytest
+
+from pyhwloc import Topology
+from pyhwloc.bitmap import Bitmap
+
+
+@pytest.fixture(scope="module")
+def cpusets(synthetic: Topology) -> tuple[Bitmap, Bitmap]:
+    """Two overlapping halves of the topology cpuset."""
+    cpuset = synthetic.cpuset
+    n = cpuset.weight()
+    lhs, rhs = Bitmap(), Bitmap()
+    lhs.set_range(0, max(n // 2, 1) - 1)
+    rhs.set_range(n // 4, n - 1)
+    return lhs, rhs
+
+
+@pytest.mark.parametrize("op", ["or", "and", "xor", "sub", "eq", "included"])
+def test_binary_op(benchmark: Any, cpusets: tuple[Bitmap, Bitmap], op: str) -> None:
+    lhs, rhs = cpusets
+    fn = {
+        "or": lambda: lhs | rhs,
+        "and": lambda: lhs & rhs,
+        "xor": lambda: lhs ^ rhs,
+        "sub": lambda: lhs - rhs,
+        "eq": lambda: lhs == rhs,
+        "included": lambda: lhs.is_included(rhs),
+    }[op]
+    benchmark(fn)
+
+
+def test_weight(benchmark: Any, synthetic: Topology) -> None:
+    benchmark(synthetic.cpuset.weight)
+
+
+def test_iter(benchmark: Any, synthetic: Topology) -> None:
+    cpuset = synthetic.cpuset
+    benchmark(lambda: sum(1 for _ in cpuset))
+
+
+def test_to_array(benchmark: Any, synthetic: Topology) -> None:
+    benchmark(synthetic.cpuset.to_array)
+
+
+def test_to_sched_set(benchmark: Any, synthetic: Topology) -> None:
+    benchmark(synthetic.cpuset.to_sched_set)
+
+
+def test_from_sched_set(benchmark: Any, synthetic: Topology) -> None:
+    index = synthetic.cpuset.to_sched_set()
+    benchmark(Bitmap.from_sched_set, index)
+
+
+def test_string_round_trip(benchmark: Any, synthetic: Topology) -> None:
+    cpuset = synthetic.cpuset
+    benchmark(lambda: Bitmap.from_list_string(cpuset.to_list_string()))
+
+
+def test_reduce_or(benchmark: Any, synthetic: Topology) -> None:
+    cpusets = [core.cpuset for core in synthetic.iter_cores()]
+    benchmark(Bitmap.reduce_or, cpusets)
+
+
+def test_object_cpuset(benchmark: Any, synthetic: Topology) -> None:
+    objs = list(synthetic.iter_cores())
+    benchmark(lambda: [obj.cpuset for obj in objs])
@@ -0,0 +1,141 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+"""Scaling of the Python layer on large and unusual machines, see
+:py:data:`pyhwloc.synthetic.PRESETS`.
+
+Each operation is benchmarked on every preset, the peak memory allocated by Python
+during a single call is reported in the ``peak_kib`` extra info. The ``linear`` tests
+run each operation on a preset scaled up to 8 times and fail if the time or memory per
+unit of work grows with the size, to catch quadratic behaviors before they show up on
+the largest machines.
+
+.. code-block:: sh
+
+    pytest ./benchmarks/test_bench_scaling.py -k linear
+"""
+
+from __future__ import annotations
+
+import gc
+import pickle
+import time
+import tracemalloc
+from typing import Any, Callable, Iterator
+
+import pytest
+
+from pyhwloc import Topology
+from pyhwloc.bitmap import Bitmap
+from pyhwloc.hwloc.core import LocalNumaNodeFlag
+from pyhwloc.hwobject import ObjType
+from pyhwloc.synthetic import PRESETS, SyntheticShape
+
+
+def _breadth_first(topo: Topology) -> Callable[[], Any]:
+    return lambda: sum(1 for _ in topo.iter_all_breadth_first())
+
+
+def _get_distances(topo: Topology) -> Callable[[], Any]:
+    def run() -> int:
+        n = 0
+        for dist in topo.get_distances():
+            n += len(dist.objects)
+            dist.release()
+        return n
+
+    return run
+
+
+def _local_numa_nodes(topo: Topology) -> Callable[[], Any]:
+    memattrs = topo.get_memattrs()
+    cores = list(topo.iter_objs_by_type(ObjType.CORE))
+    flags = LocalNumaNodeFlag.LARGER_LOCALITY
+
+    return lambda: sum(len(memattrs.get_local_numa_nodes(c, flags)) for c in cores)
+
+
+def _bitmap_ops(topo: Topology) -> Callable[[], Any]:
+    cpusets = [c.cpuset for c in topo.iter_objs_by_type(ObjType.CORE)]
+    full = topo.cpuset
+
+    def run() -> int:
+        union = Bitmap.reduce_or(cpusets)
+        rest = full - cpusets[0]
+        n = sum(1 for c in cpusets if c.is_included(rest))
+        return n + (union & rest).weight() + len(list(union))
+
+    return run
+
+
+def _pickle(topo: Topology) -> Callable[[], Any]:
+    return lambda: pickle.loads(pickle.dumps(topo)).destroy()
+
+
+# Each operation, with the expected amount of work for a topology.
+OPS: dict[str, tuple[Callable[[Topology], Callable[[], Any]], Callable]] = {
+    "iter_all_breadth_first": (
+        _breadth_first,
+        lambda topo: sum(1 for _ in topo.iter_all_breadth_first()),
+    ),
+    # The matrix has n * n values.
+    "get_distances": (_get_distances, lambda topo: topo.n_numa_nodes() ** 2),
+    "get_local_numa_nodes": (_local_numa_nodes, lambda topo: topo.n_cores()),
+    "bitmap_ops": (_bitmap_ops, lambda topo: topo.n_cpus()),
+    "pickle": (_pickle, lambda topo: sum(1 for _ in topo.iter_all_breadth_first())),
+}
+
+
+@pytest.fixture(scope="module", params=list(PRESETS))
+def preset(request: pytest.FixtureRequest) -> Iterator[Topology]:
+    with PRESETS[request.param].load() as topo:
+        yield topo
+
+
+def _peak_memory(fn: Callable[[], Any]) -> int:
+    gc.collect()
+    tracemalloc.start()
+    try:
+        fn()
+        _, peak = tracemalloc.get_traced_memory()
+    finally:
+        tracemalloc.stop()
+    return peak
+
+
+@pytest.mark.parametrize("op", list(OPS))
+def test_preset(benchmark: Any, preset: Topology, op: str) -> None:
+    fn = OPS[op][0](preset)
+    benchmark.extra_info["peak_kib"] = _peak_memory(fn) / 1024
+    benchmark.extra_info["n_pus"] = preset.n_cpus()
+    benchmark(fn)
+
+
+def _min_time(fn: Callable[[], Any], rounds: int = 7) -> float:
+    fn()
+    results = []
+    for _ in range(rounds):
+        start = time.perf_counter()
+        fn()
+        results.append(time.perf_counter() - start)
+    return min(results)
+
+
+# Allowed growth of the cost per unit of work between the smallest and the largest
+# topology. Constant overheads make it decrease for a linear operation, a quadratic one
+# grows with the scale factor.
+_SLACK = 2.5
+_BASE = SyntheticShape(packages=2, numa_per_package=2, cores=8)
+
+
+@pytest.mark.parametrize("op", list(OPS))
+def test_linear(op: str) -> None:
+    make, work = OPS[op]
+    times, peaks = [], []
+    for factor in (1, 8):
+        with _BASE.scaled(factor).load() as topo:
+            fn = make(topo)
+            units = work(topo)
+            peaks.append(_peak_memory(fn) / units)
+            times.append(_min_time(fn) / units)
+    assert times[1] < times[0] * _SLACK, times
+    assert peaks[1] < peaks[0] * _SLACK, peaks
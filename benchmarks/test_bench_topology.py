@@ -0,0 +1,87 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+"""Benchmarks for loading, traversing and pickling topologies."""
+
+from __future__ import annotations
+
+import os
+import pickle
+from pathlib import Path
+from typing import Any
+
+import pytest
+
+from pyhwloc import Topology
+from pyhwloc.distances import Distances
+from pyhwloc.hwobject import ObjType
+
+
+def test_load_this_system(benchmark: Any) -> None:
+    benchmark(lambda: Topology.from_this_system(load=True).destroy())
+
+
+def test_load_synthetic(benchmark: Any, synthetic_desc: str) -> None:
+    benchmark(lambda: Topology.from_synthetic(synthetic_desc, load=True).destroy())
+
+
+def test_load_xml_buffer(benchmark: Any, synthetic: Topology) -> None:
+    xml_buffer = synthetic.export_xml_buffer()
+    benchmark(lambda: Topology.from_xml_buffer(xml_buffer, load=True).destroy())
+
+
+def test_load_xml_file(benchmark: Any, synthetic: Topology, tmp_path: Path) -> None:
+    path = os.path.join(tmp_path, "topo.xml")
+    synthetic.export_xml_file(path)
+    benchmark(lambda: Topology.from_xml_file(path, load=True).destroy())
+
+
+def test_iter_all_breadth_first(benchmark: Any, synthetic: Topology) -> None:
+    n_objs = benchmark(lambda: sum(1 for _ in synthetic.iter_all_breadth_first()))
+    assert n_objs > synthetic.n_cpus()
+
+
+@pytest.mark.parametrize("obj_type", [ObjType.PU, ObjType.CORE, ObjType.NUMANODE])
+def test_iter_objs_by_type(
+    benchmark: Any, synthetic: Topology, obj_type: ObjType
+) -> None:
+    benchmark(lambda: sum(1 for _ in synthetic.iter_objs_by_type(obj_type)))
+
+
+def test_get_obj_by_type(benchmark: Any, synthetic: Topology) -> None:
+    n = synthetic.n_cpus()
+    benchmark(lambda: [synthetic.get_obj_by_type(ObjType.PU, i) for i in range(n)])
+
+
+def test_distances_getitem(benchmark: Any, numa_distances: Distances) -> None:
+    dist = numa_distances
+    n = dist.nbobjs
+
+    def run() -> float:
+        return sum(dist[i, j] for i in range(n) for j in range(n))
+
+    benchmark(run)
+
+
+def test_distances_get_distance(benchmark: Any, numa_distances: Distances) -> None:
+    dist = numa_distances
+    objs = dist.objects
+    benchmark(lambda: [dist.get_distance(a, b) for a in objs for b in objs])
+
+
+def test_distances_as_array(benchmark: Any, numa_distances: Distances) -> None:
+    dist = numa_distances
+
+    def run() -> int:
+        # Flatten the matrix for summation.
+        return sum(dist.as_array().cast("B").cast("Q"))
+
+    benchmark(run)
+
+
+def test_pickle_dumps(benchmark: Any, synthetic: Topology) -> None:
+    benchmark(pickle.dumps, synthetic)
+
+
+def test_pickle_loads(benchmark: Any, synthetic: Topology) -> None:
+    data = pickle.dumps(synthetic)
+    benchmark(lambda: pickle.loads(data).destroy())
@@ -0,0 +1,75 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+"""
+Benchmark for the on-disk topology cache
+========================================
+
+Compare the latency of a full discovery of this system against loading the topology
+from the on-disk XML cache.
+
+.. code-block:: sh
+
+    python benchmarks/topology_cache.py --repeat 20 --io
+"""
+
+from __future__ import annotations
+
+import argparse
+import statistics
+import tempfile
+import time
+from typing import Callable
+
+from pyhwloc import Topology
+from pyhwloc.topology import TypeFilter
+
+
+def measure(fn: Callable[[], Topology], repeat: int) -> list[float]:
+    """Return the latency of each run in milli-seconds."""
+    results = []
+    for _ in range(repeat):
+        start = time.perf_counter()
+        topo = fn()
+        end = time.perf_counter()
+        topo.destroy()
+        results.append((end - start) * 1000)
+    return results
+
+
+def report(name: str, results: list[float]) -> None:
+    print(
+        f"{name:<16} median: {statistics.median(results):8.3f} ms, "
+        f"min: {min(results):8.3f} ms, max: {max(results):8.3f} ms"
+    )
+
+
+def main(args: argparse.Namespace) -> None:
+    io_filter = TypeFilter.KEEP_ALL if args.io else None
+
+    def discover() -> Topology:
+        topo = Topology.from_this_system()
+        if io_filter is not None:
+            topo.set_io_types_filter(io_filter)
+        return topo.load()
+
+    with tempfile.TemporaryDirectory() as cache_dir:
+
+        def cached() -> Topology:
+            return Topology.from_cached_system(cache_dir, io_types_filter=io_filter)
+
+        # Populate the cache.
+        first = measure(cached, 1)
+        report("discovery", measure(discover, args.repeat))
+        report("cache (cold)", first)
+        report("cache (warm)", measure(cached, args.repeat))
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--repeat", type=int, default=10)
+    parser.add_argument(
+        "--io",
+        action="store_true",
+        help="Keep all IO devices during discovery.",
+    )
+    main(parser.parse_args())
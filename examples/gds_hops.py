@@ -5,7 +5,8 @@ Count the number of hops between PCI storage and GPUs
 =====================================================
 
 This script counts the number of hops between NVIDIA GPUs and NVME drives and checks
-whether the communication needs to go through the host socket.
+whether the communication needs to go through the host socket, using
+:py:meth:`~pyhwloc.topology.Topology.io_affinity_matrix`.
 
 Please see the `GDS document
 <https://docs.nvidia.com/gpudirect-storage/configuration-guide/>`__ for a use case.
@@ -16,6 +17,7 @@ from typing import TypeGuard, cast
 
 from pyhwloc import Topology
 from pyhwloc.hwobject import GetTypeDepth, Object, ObjType, OsDevice
+from pyhwloc.locality import IoPathKind
 from pyhwloc.topology import TypeFilter
 
 
@@ -27,59 +29,6 @@ def is_osdev_storage(obj: Object) -> TypeGuard[OsDevice]:
     return isinstance(obj, OsDevice) and obj.is_storage()
 
 
-def cnt_hops(gpu: Object, nvme: Object) -> tuple[int, bool]:
-    """Count the number of hops, and check whether the host socket is required for
-    communication.
-
-    """
-    print("GPU:", gpu, "<-> NVME:", nvme)
-    gpu_ancestors = []
-    while gpu.parent is not None:
-        gpu_ancestors.append(gpu.parent)
-        gpu = gpu.parent
-
-    nvme_ancestors = []
-    while nvme.parent is not None:
-        nvme_ancestors.append(nvme.parent)
-        nvme = nvme.parent
-
-    # Find the common ancestor
-    gpu_ancestors = list(reversed(gpu_ancestors))
-    nvme_ancestors = list(reversed(nvme_ancestors))
-    i, j = 0, 0
-    assert gpu_ancestors[i] == nvme_ancestors[j]  # must have the same root
-    while (
-        i < len(gpu_ancestors)
-        and j < len(nvme_ancestors)
-        and gpu_ancestors[i] == nvme_ancestors[j]
-    ):
-        i += 1
-        j += 1
-    assert i >= 1 and j >= 1, (i, j)
-    # It might be better to check whether this is a PCI bridge instead of checking
-    # whether this is a host device.
-    crossed = gpu_ancestors[i - 1].is_package() or gpu_ancestors[i - 1].is_machine()
-    # Assuming GPU is an OS device attached to a PCI device. There are GPUs that are
-    # connected through nvlink-C2C, which does not use PCI.
-    assert gpu_ancestors[-1].is_pci_device() and nvme_ancestors[-1].is_pci_device()
-    gpu_path = []
-    for k in range(i - 1, len(gpu_ancestors)):
-        gpu_path.append(str(gpu_ancestors[k]))
-    print("- GPU path:", " -> ".join(gpu_path[::-1]))
-    nvme_path = []
-
-    for k in range(j - 1, len(nvme_ancestors)):
-        nvme_path.append(str(nvme_ancestors[k]))
-    print("- NVME path:", " -> ".join(nvme_path[::-1]))
-    print()
-
-    # +1 for the common ancestor. -1 for removing the PCI device. OS device is a
-    # software device, which is "attached" to the PCI device. But they are the same
-    # thing.
-    n_hops = (len(gpu_ancestors) - i - 1) + (len(nvme_ancestors) - j - 1) + 1
-    return n_hops, crossed
-
-
 def pprint(table: list[list]) -> None:
     """Print the result as a table."""
     for i in range(len(table)):
@@ -115,18 +64,24 @@ if __name__ == "__main__":
                 if obj.name.lower().startswith("nvme"):
                     nvmes.append(obj)
 
+        # Hops and path kinds between all the devices, computed in one pass.
+        matrix = topo.io_affinity_matrix(kinds=None)
+        index = {dev: i for i, dev in enumerate(matrix.devices)}
+        hops, kinds = matrix.hops, matrix.path_kinds
+
         hops_rows: list[list[str | int]] = []
         cross_rows: list[list[str | bool]] = []
         hops_rows.append([cast(str, dev.name) for dev in nvmes])
         cross_rows.append([cast(str, dev.name) for dev in nvmes])
-        for i, gpu in enumerate(gpus):
+        for gpu in gpus:
             assert gpu.name is not None
             hops_row: list[str | int] = [gpu.name]
             cross_row: list[str | bool] = [gpu.name]
-            for j, nvme in enumerate(nvmes):
-                hops, cross = cnt_hops(gpu, nvme)
-                cross_row.append(cross)
-                hops_row.append(hops)
+            for nvme in nvmes:
+                i, j = index[gpu], index[nvme]
+                # Whether the host socket is required for communication.
+                cross_row.append(kinds[i, j] >= IoPathKind.PACKAGE)
+                hops_row.append(hops[i, j])
             hops_rows.append(hops_row)
             cross_rows.append(cross_row)
 
@@ -10,7 +10,7 @@ from typing import Any, Iterator
 
 import hatchling.build
 
-from .hook import BUILD_KEY, FETCH_KEY, ROOT_KEY, SRC_KEY
+from .hook import BENCH_KEY, BUILD_KEY, FASTPATH_KEY, FETCH_KEY, ROOT_KEY, SRC_KEY
 
 
 @contextmanager
@@ -20,6 +20,14 @@ def build_config(config_settings: dict[str, Any] | None) -> Iterator[None]:
             v = config_settings["fetch-hwloc"]
             assert v in ("True", "False")
             os.environ[FETCH_KEY] = v
+        if "build-benchmarks" in config_settings:
+            v = config_settings["build-benchmarks"]
+            assert v in ("True", "False")
+            os.environ[BENCH_KEY] = v
+        if "build-fastpath" in config_settings:
+            v = config_settings["build-fastpath"]
+            assert v in ("True", "False")
+            os.environ[FASTPATH_KEY] = v
         if "build-dir" in config_settings:
             os.environ[BUILD_KEY] = config_settings["build-dir"]
         if "hwloc-src-dir" in config_settings:
@@ -31,6 +39,10 @@ def build_config(config_settings: dict[str, Any] | None) -> Iterator[None]:
     finally:
         if FETCH_KEY in os.environ:
             del os.environ[FETCH_KEY]
+        if BENCH_KEY in os.environ:
+            del os.environ[BENCH_KEY]
+        if FASTPATH_KEY in os.environ:
+            del os.environ[FASTPATH_KEY]
         if BUILD_KEY in os.environ:
             del os.environ[BUILD_KEY]
         if SRC_KEY in os.environ:
@@ -19,6 +19,8 @@ FETCH_KEY = "PYHWLOC_FETCH_HWLOC"
 BUILD_KEY = "PYHWLOC_BUILD_DIR"
 ROOT_KEY = "PYHWLOC_HWLOC_ROOT_DIR"
 SRC_KEY = "PYHWLOC_HWLOC_SRC_DIR"
+BENCH_KEY = "PYHWLOC_BUILD_BENCHMARKS"
+FASTPATH_KEY = "PYHWLOC_BUILD_FASTPATH"
 
 
 def get_vs_generator() -> str:
@@ -137,7 +139,13 @@ class CMakeBuildHook(BuildHookInterface):
     def initialize(self, version: str, build_data: dict[str, Any]) -> None:
         """Run CMake build before packaging."""
         # Set platform-specific tag for the wheel
-        build_data["tag"] = f"py3-none-{next(platform_tags())}"
+        build_fastpath = os.environ.get(FASTPATH_KEY, None)
+        assert build_fastpath in (None, "True", "False")
+        if build_fastpath == "True":
+            # The extension uses the stable ABI of CPython 3.12.
+            build_data["tag"] = f"cp312-abi3-{next(platform_tags())}"
+        else:
+            build_data["tag"] = f"py3-none-{next(platform_tags())}"
         build_data["pure_python"] = False
 
         print(FETCH_KEY, ":", os.environ.get(FETCH_KEY, None))
@@ -157,6 +165,16 @@ class CMakeBuildHook(BuildHookInterface):
             cmake_args.append(f"-D{FETCH_KEY}=ON")
             print("Building with fetched hwloc from GitHub")
 
+        # Benchmark target
+        build_benchmarks = os.environ.get(BENCH_KEY, None)
+        assert build_benchmarks in (None, "True", "False")
+        if build_benchmarks == "True":
+            cmake_args.append(f"-D{BENCH_KEY}=ON")
+
+        # CPython extension
+        if build_fastpath == "True":
+            cmake_args.append(f"-D{FASTPATH_KEY}=ON")
+
         # Existing hwloc installation root
         if os.environ.get(ROOT_KEY, None) is not None:
             root_dir = os.environ[ROOT_KEY]
@@ -27,3 +27,29 @@ PYHWLOC_CUDART_EXPORT hwloc_obj_t pyhwloc_cudart_get_device_osdev_by_index(
     hwloc_topology_t topology, unsigned idx) {
   return hwloc_cudart_get_device_osdev_by_index(topology, idx);
 }
+
+// Batched locality of the CUDA runtime devices [0, n), see
+// `pyhwloc_cuda_get_devices`.
+PYHWLOC_CUDART_EXPORT int pyhwloc_cudart_get_devices(hwloc_topology_t topology,
+                                                     unsigned n,
+                                                     hwloc_cpuset_t *cpusets,
+                                                     hwloc_nodeset_t *nodesets,
+                                                     int *pci_ids,
+                                                     hwloc_obj_t *osdevs) {
+  for (unsigned i = 0; i < n; ++i) {
+    int idx = (int)i;
+    if (hwloc_cudart_get_device_cpuset(topology, idx, cpusets[i]) != 0) {
+      return -1;
+    }
+    if (hwloc_cpuset_to_nodeset(topology, cpusets[i], nodesets[i]) != 0) {
+      return -1;
+    }
+    if (hwloc_cudart_get_device_pci_ids(topology, idx, &pci_ids[3 * i],
+                                        &pci_ids[3 * i + 1],
+                                        &pci_ids[3 * i + 2]) != 0) {
+      return -1;
+    }
+    osdevs[i] = hwloc_cudart_get_device_osdev_by_index(topology, i);
+  }
+  return 0;
+}
@@ -5,6 +5,7 @@
  */
 #include "pyhwloc_cuda_export.h"
 #include <hwloc/cuda.h>
+#include <errno.h>
 
 PYHWLOC_CUDA_EXPORT int pyhwloc_cuda_get_device_pci_ids(
     hwloc_topology_t topology __hwloc_attribute_unused, CUdevice cudevice,
@@ -32,3 +33,34 @@ PYHWLOC_CUDA_EXPORT hwloc_obj_t pyhwloc_cuda_get_device_osdev_by_index(
     hwloc_topology_t topology, unsigned idx) {
   return hwloc_cuda_get_device_osdev_by_index(topology, idx);
 }
+
+// Batched locality of the CUDA devices [0, n). The caller allocates the cpusets and
+// the nodesets, `pci_ids` holds the domain, bus and dev of each device. Returns -1
+// and stops at the first failure.
+PYHWLOC_CUDA_EXPORT int pyhwloc_cuda_get_devices(hwloc_topology_t topology,
+                                                 unsigned n,
+                                                 hwloc_cpuset_t *cpusets,
+                                                 hwloc_nodeset_t *nodesets,
+                                                 int *pci_ids,
+                                                 hwloc_obj_t *osdevs) {
+  for (unsigned i = 0; i < n; ++i) {
+    CUdevice cudevice;
+    if (cuDeviceGet(&cudevice, (int)i) != CUDA_SUCCESS) {
+      errno = EINVAL;
+      return -1;
+    }
+    if (hwloc_cuda_get_device_cpuset(topology, cudevice, cpusets[i]) != 0) {
+      return -1;
+    }
+    if (hwloc_cpuset_to_nodeset(topology, cpusets[i], nodesets[i]) != 0) {
+      return -1;
+    }
+    if (hwloc_cuda_get_device_pci_ids(topology, cudevice, &pci_ids[3 * i],
+                                      &pci_ids[3 * i + 1],
+                                      &pci_ids[3 * i + 2]) != 0) {
+      return -1;
+    }
+    osdevs[i] = hwloc_cuda_get_device_osdev(topology, cudevice);
+  }
+  return 0;
+}
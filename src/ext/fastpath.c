@@ -0,0 +1,360 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+/*
+ * Optional CPython extension implementing the hottest query functions of the
+ * low-level interface without the ctypes argument conversion. The functions
+ * have the same signatures and return values as their ctypes counterparts in
+ * `pyhwloc.hwloc.core` and `pyhwloc.hwloc.bitmap`, which replace themselves
+ * with these when the extension is available.
+ *
+ * Handles are accepted as integers, None (NULL), or ctypes pointers. The latter
+ * are read through the buffer protocol.
+ */
+#define Py_LIMITED_API 0x030C0000
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <hwloc.h>
+#include <string.h>
+
+/* ctypes.POINTER(hwloc_obj), set by `_init`. */
+static PyObject *obj_ptr_type = NULL;
+
+static int check_nargs(char const *name, Py_ssize_t nargs, Py_ssize_t n) {
+  if (nargs != n) {
+    PyErr_Format(PyExc_TypeError, "%s() takes %zd arguments (%zd given)", name,
+                 n, nargs);
+    return -1;
+  }
+  return 0;
+}
+
+static int as_ptr(PyObject *o, void **out) {
+  Py_buffer view;
+  if (o == Py_None) {
+    *out = NULL;
+    return 0;
+  }
+  if (PyLong_Check(o)) {
+    *out = PyLong_AsVoidPtr(o);
+    return PyErr_Occurred() ? -1 : 0;
+  }
+  if (PyObject_GetBuffer(o, &view, PyBUF_SIMPLE) != 0) {
+    return -1;
+  }
+  if (view.len != (Py_ssize_t)sizeof(void *)) {
+    PyBuffer_Release(&view);
+    PyErr_SetString(PyExc_TypeError, "Expecting a pointer.");
+    return -1;
+  }
+  memcpy(out, view.buf, sizeof(void *));
+  PyBuffer_Release(&view);
+  return 0;
+}
+
+static int as_int(PyObject *o, int *out) {
+  long v = PyLong_AsLong(o);
+  if (v == -1 && PyErr_Occurred()) {
+    return -1;
+  }
+  *out = (int)v;
+  return 0;
+}
+
+static int as_uint(PyObject *o, unsigned *out) {
+  /* Wrap around like ctypes.c_uint. */
+  unsigned long v = PyLong_AsUnsignedLongMask(o);
+  if (v == (unsigned long)-1 && PyErr_Occurred()) {
+    return -1;
+  }
+  *out = (unsigned)v;
+  return 0;
+}
+
+/* Return None for NULL, a ctypes pointer to the object otherwise. */
+static PyObject *from_obj(hwloc_obj_t obj) {
+  PyObject *res;
+  Py_buffer view;
+  if (obj == NULL) {
+    Py_RETURN_NONE;
+  }
+  if (obj_ptr_type == NULL) {
+    PyErr_SetString(PyExc_RuntimeError, "The fast path is not initialized.");
+    return NULL;
+  }
+  res = PyObject_CallNoArgs(obj_ptr_type);
+  if (res == NULL) {
+    return NULL;
+  }
+  if (PyObject_GetBuffer(res, &view, PyBUF_WRITABLE) != 0) {
+    Py_DECREF(res);
+    return NULL;
+  }
+  memcpy(view.buf, &obj, sizeof(void *));
+  PyBuffer_Release(&view);
+  return res;
+}
+
+static PyObject *fp_init(PyObject *Py_UNUSED(self), PyObject *arg) {
+  PyObject *prev = obj_ptr_type;
+  obj_ptr_type = Py_NewRef(arg);
+  Py_XDECREF(prev);
+  Py_RETURN_NONE;
+}
+
+/* Object levels, depths and types */
+
+static PyObject *fp_get_type_depth(PyObject *Py_UNUSED(self),
+                                   PyObject *const *args, Py_ssize_t nargs) {
+  void *topology;
+  int type;
+  if (check_nargs("get_type_depth", nargs, 2) || as_ptr(args[0], &topology) ||
+      as_int(args[1], &type)) {
+    return NULL;
+  }
+  return PyLong_FromLong(
+      hwloc_get_type_depth(topology, (hwloc_obj_type_t)type));
+}
+
+static PyObject *fp_get_nbobjs_by_depth(PyObject *Py_UNUSED(self),
+                                        PyObject *const *args,
+                                        Py_ssize_t nargs) {
+  void *topology;
+  int depth;
+  if (check_nargs("get_nbobjs_by_depth", nargs, 2) ||
+      as_ptr(args[0], &topology) || as_int(args[1], &depth)) {
+    return NULL;
+  }
+  return PyLong_FromUnsignedLong(hwloc_get_nbobjs_by_depth(topology, depth));
+}
+
+static PyObject *fp_get_nbobjs_by_type(PyObject *Py_UNUSED(self),
+                                       PyObject *const *args,
+                                       Py_ssize_t nargs) {
+  void *topology;
+  int type;
+  if (check_nargs("get_nbobjs_by_type", nargs, 2) ||
+      as_ptr(args[0], &topology) || as_int(args[1], &type)) {
+    return NULL;
+  }
+  return PyLong_FromLong(
+      hwloc_get_nbobjs_by_type(topology, (hwloc_obj_type_t)type));
+}
+
+static PyObject *fp_get_root_obj(PyObject *Py_UNUSED(self),
+                                 PyObject *const *args, Py_ssize_t nargs) {
+  void *topology;
+  if (check_nargs("get_root_obj", nargs, 1) || as_ptr(args[0], &topology)) {
+    return NULL;
+  }
+  return from_obj(hwloc_get_root_obj(topology));
+}
+
+static PyObject *fp_get_obj_by_depth(PyObject *Py_UNUSED(self),
+                                     PyObject *const *args, Py_ssize_t nargs) {
+  void *topology;
+  int depth;
+  unsigned idx;
+  if (check_nargs("get_obj_by_depth", nargs, 3) ||
+      as_ptr(args[0], &topology) || as_int(args[1], &depth) ||
+      as_uint(args[2], &idx)) {
+    return NULL;
+  }
+  return from_obj(hwloc_get_obj_by_depth(topology, depth, idx));
+}
+
+static PyObject *fp_get_obj_by_type(PyObject *Py_UNUSED(self),
+                                    PyObject *const *args, Py_ssize_t nargs) {
+  void *topology;
+  int type;
+  unsigned idx;
+  if (check_nargs("get_obj_by_type", nargs, 3) || as_ptr(args[0], &topology) ||
+      as_int(args[1], &type) || as_uint(args[2], &idx)) {
+    return NULL;
+  }
+  return from_obj(
+      hwloc_get_obj_by_type(topology, (hwloc_obj_type_t)type, idx));
+}
+
+static PyObject *fp_get_next_obj_by_depth(PyObject *Py_UNUSED(self),
+                                          PyObject *const *args,
+                                          Py_ssize_t nargs) {
+  void *topology, *prev;
+  int depth;
+  if (check_nargs("get_next_obj_by_depth", nargs, 3) ||
+      as_ptr(args[0], &topology) || as_int(args[1], &depth) ||
+      as_ptr(args[2], &prev)) {
+    return NULL;
+  }
+  return from_obj(hwloc_get_next_obj_by_depth(topology, depth, prev));
+}
+
+static PyObject *fp_get_next_obj_by_type(PyObject *Py_UNUSED(self),
+                                         PyObject *const *args,
+                                         Py_ssize_t nargs) {
+  void *topology, *prev;
+  int type;
+  if (check_nargs("get_next_obj_by_type", nargs, 3) ||
+      as_ptr(args[0], &topology) || as_int(args[1], &type) ||
+      as_ptr(args[2], &prev)) {
+    return NULL;
+  }
+  return from_obj(
+      hwloc_get_next_obj_by_type(topology, (hwloc_obj_type_t)type, prev));
+}
+
+static PyObject *fp_get_pu_obj_by_os_index(PyObject *Py_UNUSED(self),
+                                           PyObject *const *args,
+                                           Py_ssize_t nargs) {
+  void *topology;
+  unsigned os_index;
+  if (check_nargs("get_pu_obj_by_os_index", nargs, 2) ||
+      as_ptr(args[0], &topology) || as_uint(args[1], &os_index)) {
+    return NULL;
+  }
+  return from_obj(hwloc_get_pu_obj_by_os_index(topology, os_index));
+}
+
+static PyObject *fp_get_numanode_obj_by_os_index(PyObject *Py_UNUSED(self),
+                                                 PyObject *const *args,
+                                                 Py_ssize_t nargs) {
+  void *topology;
+  unsigned os_index;
+  if (check_nargs("get_numanode_obj_by_os_index", nargs, 2) ||
+      as_ptr(args[0], &topology) || as_uint(args[1], &os_index)) {
+    return NULL;
+  }
+  return from_obj(hwloc_get_numanode_obj_by_os_index(topology, os_index));
+}
+
+/* Looking at Ancestor and Child Objects */
+
+static PyObject *fp_get_ancestor_obj_by_depth(PyObject *Py_UNUSED(self),
+                                              PyObject *const *args,
+                                              Py_ssize_t nargs) {
+  void *topology, *obj;
+  int depth;
+  if (check_nargs("get_ancestor_obj_by_depth", nargs, 3) ||
+      as_ptr(args[0], &topology) || as_int(args[1], &depth) ||
+      as_ptr(args[2], &obj)) {
+    return NULL;
+  }
+  return from_obj(hwloc_get_ancestor_obj_by_depth(topology, depth, obj));
+}
+
+static PyObject *fp_get_ancestor_obj_by_type(PyObject *Py_UNUSED(self),
+                                             PyObject *const *args,
+                                             Py_ssize_t nargs) {
+  void *topology, *obj;
+  int type;
+  if (check_nargs("get_ancestor_obj_by_type", nargs, 3) ||
+      as_ptr(args[0], &topology) || as_int(args[1], &type) ||
+      as_ptr(args[2], &obj)) {
+    return NULL;
+  }
+  return from_obj(hwloc_get_ancestor_obj_by_type(
+      topology, (hwloc_obj_type_t)type, obj));
+}
+
+/* The bitmap API */
+
+static PyObject *fp_bitmap_isset(PyObject *Py_UNUSED(self),
+                                 PyObject *const *args, Py_ssize_t nargs) {
+  void *bitmap;
+  unsigned i;
+  if (check_nargs("bitmap_isset", nargs, 2) || as_ptr(args[0], &bitmap) ||
+      as_uint(args[1], &i)) {
+    return NULL;
+  }
+  return PyBool_FromLong(hwloc_bitmap_isset(bitmap, i));
+}
+
+#define FP_BITMAP_UNARY(name, convert)                                         \
+  static PyObject *fp_##name(PyObject *Py_UNUSED(self), PyObject *arg) {      \
+    void *bitmap;                                                              \
+    if (as_ptr(arg, &bitmap)) {                                                \
+      return NULL;                                                             \
+    }                                                                          \
+    return convert(hwloc_##name(bitmap));                                      \
+  }
+
+FP_BITMAP_UNARY(bitmap_iszero, PyBool_FromLong)
+FP_BITMAP_UNARY(bitmap_weight, PyLong_FromLong)
+FP_BITMAP_UNARY(bitmap_first, PyLong_FromLong)
+FP_BITMAP_UNARY(bitmap_last, PyLong_FromLong)
+
+#define FP_BITMAP_BINARY(name)                                                 \
+  static PyObject *fp_##name(PyObject *Py_UNUSED(self),                        \
+                             PyObject *const *args, Py_ssize_t nargs) {        \
+    void *bitmap1, *bitmap2;                                                   \
+    if (check_nargs(#name, nargs, 2) || as_ptr(args[0], &bitmap1) ||           \
+        as_ptr(args[1], &bitmap2)) {                                           \
+      return NULL;                                                             \
+    }                                                                          \
+    return PyBool_FromLong(hwloc_##name(bitmap1, bitmap2));                    \
+  }
+
+FP_BITMAP_BINARY(bitmap_intersects)
+FP_BITMAP_BINARY(bitmap_isincluded)
+FP_BITMAP_BINARY(bitmap_isequal)
+
+static PyObject *fp_bitmap_next(PyObject *Py_UNUSED(self),
+                                PyObject *const *args, Py_ssize_t nargs) {
+  void *bitmap;
+  int prev;
+  if (check_nargs("bitmap_next", nargs, 2) || as_ptr(args[0], &bitmap) ||
+      as_int(args[1], &prev)) {
+    return NULL;
+  }
+  return PyLong_FromLong(hwloc_bitmap_next(bitmap, prev));
+}
+
+#define FP_FASTCALL(name, cfunc)                                               \
+  {#name, (PyCFunction)(void (*)(void))fp_##name, METH_FASTCALL,               \
+   "See :c:func:`" #cfunc "`"}
+#define FP_O(name, cfunc)                                                      \
+  {#name, (PyCFunction)fp_##name, METH_O, "See :c:func:`" #cfunc "`"}
+
+static PyMethodDef fastpath_methods[] = {
+    {"_init", (PyCFunction)fp_init, METH_O,
+     "Set the ctypes pointer type used for returning objects."},
+    FP_FASTCALL(get_type_depth, hwloc_get_type_depth),
+    FP_FASTCALL(get_nbobjs_by_depth, hwloc_get_nbobjs_by_depth),
+    FP_FASTCALL(get_nbobjs_by_type, hwloc_get_nbobjs_by_type),
+    FP_FASTCALL(get_root_obj, hwloc_get_root_obj),
+    FP_FASTCALL(get_obj_by_depth, hwloc_get_obj_by_depth),
+    FP_FASTCALL(get_obj_by_type, hwloc_get_obj_by_type),
+    FP_FASTCALL(get_next_obj_by_depth, hwloc_get_next_obj_by_depth),
+    FP_FASTCALL(get_next_obj_by_type, hwloc_get_next_obj_by_type),
+    FP_FASTCALL(get_pu_obj_by_os_index, hwloc_get_pu_obj_by_os_index),
+    FP_FASTCALL(get_numanode_obj_by_os_index,
+                hwloc_get_numanode_obj_by_os_index),
+    FP_FASTCALL(get_ancestor_obj_by_depth, hwloc_get_ancestor_obj_by_depth),
+    FP_FASTCALL(get_ancestor_obj_by_type, hwloc_get_ancestor_obj_by_type),
+    FP_FASTCALL(bitmap_isset, hwloc_bitmap_isset),
+    FP_O(bitmap_iszero, hwloc_bitmap_iszero),
+    FP_O(bitmap_weight, hwloc_bitmap_weight),
+    FP_O(bitmap_first, hwloc_bitmap_first),
+    FP_O(bitmap_last, hwloc_bitmap_last),
+    FP_FASTCALL(bitmap_next, hwloc_bitmap_next),
+    FP_FASTCALL(bitmap_intersects, hwloc_bitmap_intersects),
+    FP_FASTCALL(bitmap_isincluded, hwloc_bitmap_isincluded),
+    FP_FASTCALL(bitmap_isequal, hwloc_bitmap_isequal),
+    {NULL, NULL, 0, NULL},
+};
+
+static struct PyModuleDef fastpath_module = {
+    PyModuleDef_HEAD_INIT,
+    .m_name = "_fastpath",
+    .m_doc = "Native fast path for the hottest functions of the low-level "
+             "interface.",
+    .m_size = -1,
+    .m_methods = fastpath_methods,
+};
+
+PyMODINIT_FUNC PyInit__fastpath(void) {
+  return PyModule_Create(&fastpath_module);
+}
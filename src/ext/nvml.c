@@ -5,6 +5,7 @@
  */
 #include "pyhwloc_nvml_export.h"
 #include <hwloc/nvml.h>
+#include <errno.h>
 
 PYHWLOC_NVML_EXPORT int pyhwloc_nvml_get_device_cpuset(
     hwloc_topology_t topology __hwloc_attribute_unused, nvmlDevice_t device,
@@ -21,3 +22,36 @@ PYHWLOC_NVML_EXPORT hwloc_obj_t
 pyhwloc_nvml_get_device_osdev(hwloc_topology_t topology, nvmlDevice_t device) {
   return hwloc_nvml_get_device_osdev(topology, device);
 }
+
+// Batched locality of the NVML devices [0, n), see `pyhwloc_cuda_get_devices`.
+// NVML must be initialized by the caller.
+PYHWLOC_NVML_EXPORT int pyhwloc_nvml_get_devices(hwloc_topology_t topology,
+                                                 unsigned n,
+                                                 hwloc_cpuset_t *cpusets,
+                                                 hwloc_nodeset_t *nodesets,
+                                                 int *pci_ids,
+                                                 hwloc_obj_t *osdevs) {
+  for (unsigned i = 0; i < n; ++i) {
+    nvmlDevice_t device;
+    nvmlPciInfo_t pci;
+    if (nvmlDeviceGetHandleByIndex(i, &device) != NVML_SUCCESS) {
+      errno = EINVAL;
+      return -1;
+    }
+    if (hwloc_nvml_get_device_cpuset(topology, device, cpusets[i]) != 0) {
+      return -1;
+    }
+    if (hwloc_cpuset_to_nodeset(topology, cpusets[i], nodesets[i]) != 0) {
+      return -1;
+    }
+    if (nvmlDeviceGetPciInfo(device, &pci) != NVML_SUCCESS) {
+      errno = ENOSYS;
+      return -1;
+    }
+    pci_ids[3 * i] = (int)pci.domain;
+    pci_ids[3 * i + 1] = (int)pci.bus;
+    pci_ids[3 * i + 2] = (int)pci.device;
+    osdevs[i] = hwloc_nvml_get_device_osdev(topology, device);
+  }
+  return 0;
+}
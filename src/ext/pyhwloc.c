@@ -313,3 +313,97 @@ PYHWLOC_EXPORT int pyhwloc_distances_remove_by_type(hwloc_topology_t topology,
                                                     hwloc_obj_type_t type) {
   return hwloc_distances_remove_by_type(topology, type);
 }
+
+// Batched queries
+//
+// Not part of hwloc. These fill caller-provided flat arrays in a single call to avoid
+// one FFI round trip per object.
+struct pyhwloc_level_snapshot_s {
+  unsigned *os_index;
+  unsigned *logical_index;
+  hwloc_uint64_t *gp_index;
+  hwloc_uint64_t *parent_gp_index;
+  int *cpuset_first;
+  int *cpuset_last;
+  int *cpuset_weight;
+  int *nodeset_first;
+};
+
+PYHWLOC_EXPORT int
+pyhwloc_snapshot_level(hwloc_topology_t topology, int depth,
+                       struct pyhwloc_level_snapshot_s *snapshot,
+                       unsigned max) {
+  hwloc_obj_t obj = NULL;
+  unsigned i = 0;
+  if (!snapshot)
+    return -1;
+  // Columns set to NULL are skipped.
+  while (i < max &&
+         (obj = hwloc_get_next_obj_by_depth(topology, depth, obj)) != NULL) {
+    if (snapshot->os_index)
+      snapshot->os_index[i] = obj->os_index;
+    if (snapshot->logical_index)
+      snapshot->logical_index[i] = obj->logical_index;
+    if (snapshot->gp_index)
+      snapshot->gp_index[i] = obj->gp_index;
+    if (snapshot->parent_gp_index)
+      snapshot->parent_gp_index[i] =
+          obj->parent ? obj->parent->gp_index : (hwloc_uint64_t)-1;
+    if (snapshot->cpuset_first)
+      snapshot->cpuset_first[i] =
+          obj->cpuset ? hwloc_bitmap_first(obj->cpuset) : -1;
+    if (snapshot->cpuset_last)
+      snapshot->cpuset_last[i] =
+          obj->cpuset ? hwloc_bitmap_last(obj->cpuset) : -1;
+    if (snapshot->cpuset_weight)
+      snapshot->cpuset_weight[i] =
+          obj->cpuset ? hwloc_bitmap_weight(obj->cpuset) : -1;
+    if (snapshot->nodeset_first)
+      snapshot->nodeset_first[i] =
+          obj->nodeset ? hwloc_bitmap_first(obj->nodeset) : -1;
+    ++i;
+  }
+  return (int)i;
+}
+
+PYHWLOC_EXPORT int pyhwloc_bitmap_to_indices(hwloc_const_bitmap_t bitmap,
+                                             unsigned *indices, unsigned max) {
+  // Returns the number of set bits, -1 if the bitmap is infinite. At most `max`
+  // indices are written, pass 0 to query the required size.
+  int weight = hwloc_bitmap_weight(bitmap);
+  unsigned i = 0;
+  int id;
+  if (weight < 0)
+    return -1;
+  for (id = hwloc_bitmap_first(bitmap); id != -1 && i < max;
+       id = hwloc_bitmap_next(bitmap, id)) {
+    indices[i++] = (unsigned)id;
+  }
+  return weight;
+}
+
+PYHWLOC_EXPORT int pyhwloc_bitmap_reduce_or(hwloc_bitmap_t res,
+                                            hwloc_const_bitmap_t const *bitmaps,
+                                            unsigned n) {
+  // Union of `n` bitmaps, the result is empty if `n` is 0.
+  unsigned i;
+  hwloc_bitmap_zero(res);
+  for (i = 0; i < n; ++i) {
+    if (hwloc_bitmap_or(res, res, bitmaps[i]) != 0)
+      return -1;
+  }
+  return 0;
+}
+
+PYHWLOC_EXPORT int pyhwloc_bitmap_reduce_and(hwloc_bitmap_t res,
+                                             hwloc_const_bitmap_t const *bitmaps,
+                                             unsigned n) {
+  // Intersection of `n` bitmaps, the result is full if `n` is 0.
+  unsigned i;
+  hwloc_bitmap_fill(res);
+  for (i = 0; i < n; ++i) {
+    if (hwloc_bitmap_and(res, res, bitmaps[i]) != 0)
+      return -1;
+  }
+  return 0;
+}
@@ -5,13 +5,15 @@ The Top Level Module
 ====================
 
 The top-level pyhwloc exports some shorthands for creating the
-:py:class:`~pyhwloc.topology.Topology`.
+:py:class:`~pyhwloc.topology.Topology`, and the statistics of the
+:py:mod:`~pyhwloc.instrument` module.
 
 """
 
 from __future__ import annotations
 
 from .hwloc import __version__
+from .instrument import stats
 from .topology import (
     Topology,
     from_pid,
@@ -29,4 +31,5 @@ __all__ = [
     "from_synthetic",
     "from_xml_file",
     "from_xml_buffer",
+    "stats",
 ]
@@ -0,0 +1,269 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+"""
+Core Allocation
+===============
+
+Hand out exclusive cores, PUs or cache domains to jobs sharing a node, see
+:py:meth:`~pyhwloc.topology.Topology.core_allocator`. The allocator only tracks the
+units handed out by itself, create one allocator for the node and share it between the
+jobs.
+
+.. code-block::
+
+    with Topology() as topo:
+        allocator = topo.core_allocator(ObjType.CORE)
+        with allocator.allocate(4) as cores:
+            # Four cores packed inside an L3 if possible. One thread per core:
+            for cpuset in cores.cpusets:
+                cpuset = topo.singlify_per_core(cpuset)
+
+"""
+
+from __future__ import annotations
+
+import threading
+from copy import copy
+from types import TracebackType
+from typing import TYPE_CHECKING, Type
+
+from .bitmap import Bitmap
+from .hwobject import Object, ObjType
+
+if TYPE_CHECKING:
+    from .topology import Topology
+
+__all__ = ["Allocation", "CoreAllocator"]
+
+
+class Allocation:
+    """Units handed out by :py:meth:`CoreAllocator.allocate`. Use it as a context
+    manager or call :py:meth:`release` to return the units to the allocator."""
+
+    def __init__(self, allocator: CoreAllocator, units: list[int]) -> None:
+        self._allocator = allocator
+        self._units = units
+        self._released = False
+
+    @property
+    def units(self) -> list[int]:
+        """Indices of the allocated units, see :py:attr:`CoreAllocator.cpusets`."""
+        return list(self._units)
+
+    @property
+    def cpusets(self) -> list[Bitmap]:
+        """Allowed CPUs of each allocated unit."""
+        return [copy(self._allocator._cpusets[u]) for u in self._units]
+
+    @property
+    def cpuset(self) -> Bitmap:
+        """Allowed CPUs of all the allocated units."""
+        return Bitmap.reduce_or([self._allocator._cpusets[u] for u in self._units])
+
+    @property
+    def released(self) -> bool:
+        """Whether the units have been returned to the allocator."""
+        return self._released
+
+    def __len__(self) -> int:
+        return len(self._units)
+
+    def release(self) -> None:
+        """Return the units to the allocator. No-op if they have been released."""
+        self._allocator._release(self)
+
+    def __enter__(self) -> Allocation:
+        return self
+
+    def __exit__(
+        self,
+        exc_type: Type[BaseException] | None,
+        exc_val: BaseException | None,
+        exc_tb: TracebackType | None,
+    ) -> None:
+        self.release()
+
+    def __repr__(self) -> str:
+        return f"Allocation(units={self._units}, cpuset={self.cpuset})"
+
+
+class CoreAllocator:
+    """Allocator of exclusive topology units. All the methods are thread-safe, an
+    allocation is done atomically under the lock of the allocator.
+
+    Units are packed inside a group, like an L3 cache, before spreading to other groups:
+    the smallest group with enough free units is used. When no group has enough free
+    units, the groups with the most free units are used first. For units smaller than a
+    core, PUs of idle cores are preferred to the siblings of the allocated ones.
+
+    Parameters
+    ----------
+    topology :
+        A loaded topology. It's only used during construction.
+    unit :
+        Type of the allocated objects, like
+        :py:attr:`~pyhwloc.hwobject.ObjType.CORE`,
+        :py:attr:`~pyhwloc.hwobject.ObjType.PU` or
+        :py:attr:`~pyhwloc.hwobject.ObjType.L3CACHE`. Only the allowed CPUs of the
+        units are used, units without any allowed CPU are excluded.
+    group :
+        Type of the objects to pack the units into. Falls back to the package, then to
+        the machine, for units without an ancestor of this type.
+
+    """
+
+    def __init__(
+        self,
+        topology: Topology,
+        unit: ObjType = ObjType.CORE,
+        *,
+        group: ObjType = ObjType.L3CACHE,
+    ) -> None:
+        allowed = topology.allowed_cpuset
+        self._unit = unit
+        self._cpusets: list[Bitmap] = []
+        # Group and core of each unit.
+        self._groups: list[int] = []
+        self._cores: list[int] = []
+        group_ids: dict[int, int] = {}
+        core_ids: dict[int, int] = {}
+        for obj in topology.iter_objs_by_type(unit):
+            cpuset = obj.cpuset
+            if cpuset is None:
+                continue
+            cpuset &= allowed
+            if cpuset.is_zero():
+                continue
+            self._cpusets.append(cpuset)
+            g = _ancestor(obj, group)
+            self._groups.append(group_ids.setdefault(g.gp_index, len(group_ids)))
+            c = obj.get_ancestor_obj_by_type(ObjType.CORE) or obj
+            self._cores.append(core_ids.setdefault(c.gp_index, len(core_ids)))
+        if not self._cpusets:
+            raise ValueError(f"No object of type {unit.name} with allowed CPUs.")
+
+        self._n_groups = len(group_ids)
+        self._free = [True] * len(self._cpusets)
+        # Number of allocated units in each core.
+        self._busy = [0] * len(core_ids)
+        self._lock = threading.Lock()
+
+    @property
+    def unit(self) -> ObjType:
+        """Type of the allocated objects."""
+        return self._unit
+
+    @property
+    def cpusets(self) -> list[Bitmap]:
+        """Allowed CPUs of each unit, indexed by the unit index."""
+        return [copy(c) for c in self._cpusets]
+
+    def __len__(self) -> int:
+        return len(self._cpusets)
+
+    @property
+    def n_free(self) -> int:
+        """Number of free units."""
+        with self._lock:
+            return sum(self._free)
+
+    @property
+    def free_cpuset(self) -> Bitmap:
+        """CPUs of the free units."""
+        with self._lock:
+            cpusets = [c for c, free in zip(self._cpusets, self._free) if free]
+        return Bitmap.reduce_or(cpusets) if cpusets else Bitmap()
+
+    def _pick(self, candidates: list[int]) -> int:
+        # Prefer the units of idle cores, then the units with lower indices.
+        return min(candidates, key=lambda u: (self._busy[self._cores[u]], u))
+
+    def try_allocate(self, n: int = 1, *, spread: bool = False) -> Allocation | None:
+        """Same as :py:meth:`allocate`, but returns None if there are not enough free
+        units."""
+        if n < 1:
+            raise ValueError("Number of units must be positive.")
+        with self._lock:
+            free: list[list[int]] = [[] for _ in range(self._n_groups)]
+            for u, is_free in enumerate(self._free):
+                if is_free:
+                    free[self._groups[u]].append(u)
+            if sum(len(f) for f in free) < n:
+                return None
+
+            by_size = sorted(range(self._n_groups), key=lambda g: (-len(free[g]), g))
+            fits = [g for g in by_size if len(free[g]) >= n]
+            if spread:
+                order = [g for g in by_size if free[g]]
+            elif fits:
+                order = [min(fits, key=lambda g: (len(free[g]), g))]
+            else:
+                order = by_size
+
+            units: list[int] = []
+            while len(units) < n:
+                for g in order:
+                    if not free[g]:
+                        continue
+                    u = self._pick(free[g])
+                    free[g].remove(u)
+                    self._free[u] = False
+                    self._busy[self._cores[u]] += 1
+                    units.append(u)
+                    # Packing fills a group before moving to the next one, spreading
+                    # takes one unit from each group in turn.
+                    if len(units) == n or not spread:
+                        break
+            return Allocation(self, sorted(units))
+
+    def allocate(self, n: int = 1, *, spread: bool = False) -> Allocation:
+        """Allocate `n` exclusive units.
+
+        Parameters
+        ----------
+        n :
+            Number of units.
+        spread :
+            Take the units from as many groups as possible instead of packing them, for
+            instance to maximize the memory bandwidth.
+
+        Returns
+        -------
+        The allocated units. A :py:class:`RuntimeError` is raised if there are not
+        enough free units.
+        """
+        allocation = self.try_allocate(n, spread=spread)
+        if allocation is None:
+            raise RuntimeError(
+                f"Not enough free units of type {self._unit.name}: requested {n}, "
+                f"{self.n_free} available."
+            )
+        return allocation
+
+    def _release(self, allocation: Allocation) -> None:
+        if allocation._allocator is not self:
+            raise ValueError("The allocation belongs to another allocator.")
+        with self._lock:
+            if allocation._released:
+                return
+            for u in allocation._units:
+                self._free[u] = True
+                self._busy[self._cores[u]] -= 1
+            allocation._released = True
+
+    def __repr__(self) -> str:
+        return (
+            f"CoreAllocator(unit={self._unit.name}, n_units={len(self)}, "
+            f"n_free={self.n_free})"
+        )
+
+
+def _ancestor(obj: Object, group: ObjType) -> Object:
+    for obj_type in (group, ObjType.PACKAGE):
+        ancestor = obj.get_ancestor_obj_by_type(obj_type)
+        if ancestor is not None:
+            return ancestor
+    root = obj
+    while root.parent is not None:
+        root = root.parent
+    return root
@@ -7,13 +7,14 @@ The Bitmap Interface
 
 from __future__ import annotations
 
+import array
 import ctypes
 from collections.abc import Iterable
 from typing import Iterator, Sequence
 
 from .hwloc import bitmap as _bitmap
 from .hwloc import sched as _sched
-from .utils import _reuse_doc
+from .utils import _array_ptr, _reuse_doc
 
 __all__ = ["Bitmap", "compare_first"]
 
@@ -179,8 +180,38 @@ class Bitmap:
         """Convert bitmap to taskset string representation (Concatenated hex strings)."""
         return _bitmap.bitmap_taskset_asprintf(self._hdl)
 
+    def to_array(self) -> array.array[int]:
+        """Export the indices of all set bits into an unsigned int
+        :py:class:`array.array` with a single native call. Raises
+        :py:class:`ValueError` if the bitmap is infinite.
+
+        """
+        n = _bitmap.bitmap_to_indices(self._hdl, None, 0)
+        indices = array.array("I", [0]) * n
+        if n > 0:
+            _bitmap.bitmap_to_indices(self._hdl, _array_ptr(indices, ctypes.c_uint), n)
+        return indices
+
+    def to_ulongs(self) -> array.array[int]:
+        """Export the raw unsigned long words of the bitmap into an
+        :py:class:`array.array`. Raises :py:class:`ValueError` if the bitmap is
+        infinite.
+
+        """
+        n = _bitmap.bitmap_nr_ulongs(self._hdl)
+        if n < 0:
+            raise ValueError("Cannot export words of an infinite bitmap.")
+        masks = array.array("L", [0]) * n
+        if n > 0:
+            _bitmap.bitmap_to_ulongs(self._hdl, n, _array_ptr(masks, ctypes.c_ulong))
+        return masks
+
     def __iter__(self) -> Iterator[int]:
         """Iterate over set bits in the bitmap."""
+        if _bitmap.bitmap_weight(self._hdl) >= 0:
+            # Finite bitmap, export all indices at once.
+            yield from self.to_array()
+            return
         bit = _bitmap.bitmap_first(self._hdl)
         while bit != -1:
             yield bit
@@ -282,6 +313,60 @@ class Bitmap:
         _bitmap.bitmap_not(result._hdl, self._hdl)
         return result
 
+    def __sub__(self, other: Bitmap) -> Bitmap:
+        return self.andnot(other)
+
+    # In-place operators, hwloc allows the result to alias the inputs, no temporary
+    # bitmap is allocated.
+    def __ior__(self, other: Bitmap) -> Bitmap:
+        _bitmap.bitmap_or(self._hdl, self._hdl, other._hdl)
+        return self
+
+    def __iand__(self, other: Bitmap) -> Bitmap:
+        _bitmap.bitmap_and(self._hdl, self._hdl, other._hdl)
+        return self
+
+    def __ixor__(self, other: Bitmap) -> Bitmap:
+        _bitmap.bitmap_xor(self._hdl, self._hdl, other._hdl)
+        return self
+
+    def __isub__(self, other: Bitmap) -> Bitmap:
+        _bitmap.bitmap_andnot(self._hdl, self._hdl, other._hdl)
+        return self
+
+    @staticmethod
+    def _handles(bitmaps: list[Bitmap]) -> tuple[ctypes.Array, int]:
+        # The caller must keep `bitmaps` alive until the native call returns, the
+        # handles are freed along with the wrappers.
+        hdls = [b.native_handle for b in bitmaps]
+        return (_bitmap.const_bitmap_t * len(hdls))(*hdls), len(hdls)
+
+    @classmethod
+    def reduce_or(cls, bitmaps: Iterable[Bitmap]) -> Bitmap:
+        """Union of all bitmaps, computed in a single native call. Returns an empty
+        bitmap if `bitmaps` is empty.
+
+        """
+        # Hold the wrappers, a generator may yield temporaries.
+        items = list(bitmaps)
+        arr, n = cls._handles(items)
+        result = Bitmap()
+        _bitmap.bitmap_reduce_or(result._hdl, arr, n)
+        return result
+
+    @classmethod
+    def reduce_and(cls, bitmaps: Iterable[Bitmap]) -> Bitmap:
+        """Intersection of all bitmaps, computed in a single native call. Returns a full
+        bitmap if `bitmaps` is empty.
+
+        """
+        # Hold the wrappers, a generator may yield temporaries.
+        items = list(bitmaps)
+        arr, n = cls._handles(items)
+        result = Bitmap()
+        _bitmap.bitmap_reduce_and(result._hdl, arr, n)
+        return result
+
     def __str__(self) -> str:
         return self.to_list_string()
 
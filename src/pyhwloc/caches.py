@@ -0,0 +1,257 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+"""
+Cache Profiles
+==============
+
+Effective data cache capacity per thread for a cpuset, see
+:py:meth:`~pyhwloc.topology.Topology.cache_profile`. The profile assumes one thread on
+each PU of the cpuset, a cache shared by several PUs of the cpuset is divided between
+them. Pass a cpuset with one PU per core to plan for one thread per core.
+
+.. code-block::
+
+    with Topology.from_this_system(load=True) as topo:
+        profile = topo.cache_profile(topo.allowed_cpuset)
+        for level in profile.levels:
+            print(f"L{level.level}", level.per_thread, level.shared)
+        # Side of the square tiles for a single precision GEMM blocked for L2.
+        b = profile.square_tile(2, itemsize=4, n_arrays=3)
+
+"""
+
+from __future__ import annotations
+
+import math
+import weakref
+from copy import copy
+from dataclasses import dataclass
+from typing import TYPE_CHECKING, cast
+
+from .bitmap import Bitmap
+from .hwloc import core as _core
+from .hwobject import Cache, Object, ObjType, _object
+
+if TYPE_CHECKING:
+    from .topology import Topology
+
+__all__ = ["CacheLevel", "CacheProfile"]
+
+
+@dataclass(frozen=True)
+class CacheLevel:
+    """Data or unified caches of the same level covering a cpuset. When the CPUs of the
+    cpuset have different caches, like a hybrid CPU, the smallest values are
+    reported."""
+
+    level: int
+    """Depth of the caches, 1 for L1."""
+    cache_type: _core.ObjCacheType
+    """Either unified or data."""
+    size: int
+    """Size of a single cache in bytes."""
+    linesize: int
+    """Cache-line size in bytes, 0 if unknown."""
+    associativity: int
+    """Ways of associativity, -1 if fully associative, 0 if unknown."""
+    n_caches: int
+    """Number of caches intersecting the cpuset."""
+    pus_per_cache: int
+    """Number of PUs sharing a cache, including the PUs outside of the cpuset."""
+    threads_per_cache: int
+    """Number of PUs of the cpuset sharing a cache."""
+    shared: bool
+    """Whether the caches are shared between cores, as opposed to the private caches
+    below :py:func:`~pyhwloc.hwloc.core.get_shared_cache_covering_obj`. Private caches
+    might still be shared by the hardware threads of a core."""
+    capacity: int
+    """Cumulative size of the caches intersecting the cpuset."""
+    per_thread: int
+    """Effective capacity for each thread in bytes, the size of a cache divided by the
+    number of threads sharing it."""
+
+    def block_bytes(self, occupancy: float = 0.5) -> int:
+        """Suggested working set of a thread in bytes, rounded down to the cache-line
+        size.
+
+        Parameters
+        ----------
+        occupancy :
+            Fraction of :py:attr:`per_thread` used by the block, the rest is left for
+            other data and conflict misses.
+        """
+        if not 0.0 < occupancy <= 1.0:
+            raise ValueError("`occupancy` must be in (0, 1].")
+        nbytes = int(self.per_thread * occupancy)
+        if self.linesize > 0:
+            nbytes -= nbytes % self.linesize
+        return nbytes
+
+
+class CacheProfile:
+    """Cache hierarchy as seen by the threads running on a cpuset.
+
+    Parameters
+    ----------
+    topology :
+        A loaded topology.
+    cpuset :
+        The CPUs of the threads. A :py:class:`set` of CPU indices is accepted as well.
+
+    """
+
+    def __init__(self, topology: Topology, cpuset: Bitmap | set[int]) -> None:
+        if isinstance(cpuset, set):
+            cpuset = Bitmap.from_sched_set(cpuset)
+        else:
+            cpuset = copy(cpuset)
+        self._cpuset = cpuset & topology.cpuset
+        self._levels = _profile(topology, self._cpuset)
+
+    @property
+    def cpuset(self) -> Bitmap:
+        """The CPUs of the threads, limited to the CPUs of the topology."""
+        return copy(self._cpuset)
+
+    @property
+    def n_threads(self) -> int:
+        """Number of PUs in the cpuset."""
+        return self._cpuset.weight()
+
+    @property
+    def levels(self) -> list[CacheLevel]:
+        """Data and unified cache levels from L1 upward. Empty if the topology has no
+        cache information."""
+        return list(self._levels)
+
+    @property
+    def private_levels(self) -> list[CacheLevel]:
+        """Levels that aren't shared between cores."""
+        return [lvl for lvl in self._levels if not lvl.shared]
+
+    @property
+    def shared_levels(self) -> list[CacheLevel]:
+        """Levels that are shared between cores."""
+        return [lvl for lvl in self._levels if lvl.shared]
+
+    def __getitem__(self, level: int) -> CacheLevel:
+        """Get a level by its depth, 1 for L1."""
+        for lvl in self._levels:
+            if lvl.level == level:
+                return lvl
+        raise KeyError(f"No L{level} cache in the cpuset.")
+
+    def block_size(
+        self,
+        level: int,
+        itemsize: int,
+        *,
+        n_arrays: int = 1,
+        occupancy: float = 0.5,
+    ) -> int:
+        """Suggested number of items of a 1-dimensional block, like a run of a merge
+        sort, such that `n_arrays` blocks fit in the cache of a thread.
+
+        Parameters
+        ----------
+        level :
+            Depth of the cache to block for.
+        itemsize :
+            Size of an item in bytes.
+        n_arrays :
+            Number of blocks in the working set of a thread.
+        occupancy :
+            See :py:meth:`CacheLevel.block_bytes`.
+        """
+        if itemsize <= 0 or n_arrays <= 0:
+            raise ValueError("`itemsize` and `n_arrays` must be positive.")
+        return self[level].block_bytes(occupancy) // (n_arrays * itemsize)
+
+    def square_tile(
+        self,
+        level: int,
+        itemsize: int,
+        *,
+        n_arrays: int = 3,
+        occupancy: float = 0.5,
+    ) -> int:
+        """Suggested side of square tiles, like the blocks of a GEMM, such that
+        `n_arrays` tiles fit in the cache of a thread. The side is rounded down to a
+        multiple of the items in a cache line when possible.
+
+        Parameters
+        ----------
+        level :
+            Depth of the cache to block for.
+        itemsize :
+            Size of an item in bytes.
+        n_arrays :
+            Number of tiles in the working set of a thread, 3 for ``C += A @ B``.
+        occupancy :
+            See :py:meth:`CacheLevel.block_bytes`.
+        """
+        n = self.block_size(level, itemsize, n_arrays=n_arrays, occupancy=occupancy)
+        side = math.isqrt(n)
+        per_line = self[level].linesize // itemsize
+        if per_line > 1 and side >= per_line:
+            side -= side % per_line
+        return side
+
+    def __repr__(self) -> str:
+        levels = ", ".join(f"L{lvl.level}={lvl.per_thread}" for lvl in self._levels)
+        return f"CacheProfile(n_threads={self.n_threads}, per_thread=[{levels}])"
+
+
+def _profile(topology: Topology, cpuset: Bitmap) -> list[CacheLevel]:
+    topo_ref = weakref.ref(topology)
+    hdl = topology.native_handle
+    # Caches of each level intersecting the cpuset, keyed by the GP index.
+    caches: dict[int, dict[int, Cache]] = {}
+    # Levels at or above the first cache shared by a core.
+    shared_levels: set[int] = set()
+    for pu in topology.iter_cpus():
+        if pu.os_index not in cpuset:
+            continue
+        core = pu.get_ancestor_obj_by_type(ObjType.CORE) or pu
+        shared = _core.get_shared_cache_covering_obj(hdl, core.native_handle)
+        first_shared = (
+            cast(Cache, _object(shared, topo_ref)).cache_depth if shared else math.inf
+        )
+        parent = pu.parent
+        while parent is not None:
+            if parent.is_dcache():
+                cache = cast(Cache, parent)
+                level = cache.cache_depth
+                caches.setdefault(level, {})[cache.gp_index] = cache
+                if level >= first_shared:
+                    shared_levels.add(level)
+            parent = parent.parent
+
+    levels = []
+    for level in sorted(caches):
+        objs = list(caches[level].values())
+        n_threads = [_n_threads(c, cpuset) for c in objs]
+        levels.append(
+            CacheLevel(
+                level=level,
+                cache_type=_core.ObjCacheType(objs[0].cache_type),
+                size=min(c.size for c in objs),
+                linesize=min(c.linesize for c in objs),
+                associativity=min(c.associativity for c in objs),
+                n_caches=len(objs),
+                pus_per_cache=max(_n_threads(c, None) for c in objs),
+                threads_per_cache=max(n_threads),
+                shared=level in shared_levels,
+                capacity=sum(c.size for c in objs),
+                per_thread=min(c.size // n for c, n in zip(objs, n_threads)),
+            )
+        )
+    return levels
+
+
+def _n_threads(obj: Object, cpuset: Bitmap | None) -> int:
+    obj_cpuset = obj.cpuset
+    assert obj_cpuset is not None
+    if cpuset is not None:
+        obj_cpuset = obj_cpuset & cpuset
+    return max(obj_cpuset.weight(), 1)
@@ -7,10 +7,26 @@ CPU Kinds
 CPU Kinds is a structure inside the topology. The Python interface implements it as an
 independent class.
 
+On hybrid CPUs, :py:meth:`CpuKinds.partition` ranks the kinds from the most performant
+to the most energy efficient. The ranks can be used to place work on a kind:
+
+.. code-block::
+
+    with Topology.from_this_system(load=True) as topo:
+        kinds = topo.get_cpukinds().partition()
+        # Latency-sensitive work on the fastest cores.
+        topo.set_cpubind(kinds[0].cpuset, CpuBindFlags.THREAD)
+        # Background work on the most efficient cores.
+        plan = topo.distribute(4, kind=len(kinds) - 1)
+
+See also :py:meth:`pyhwloc.executor.TopologyExecutor.submit_to_kind`.
+
 """
 
 from __future__ import annotations
 
+from copy import copy
+from dataclasses import dataclass
 from typing import TYPE_CHECKING
 
 from .hwloc import core as _core
@@ -20,6 +36,49 @@ if TYPE_CHECKING:
     from .bitmap import Bitmap
     from .utils import _TopoRef
 
+__all__ = ["CpuKind", "CpuKinds"]
+
+
+def _parse_int(value: str | None) -> int | None:
+    if value is None:
+        return None
+    try:
+        return int(value)
+    except ValueError:
+        return None
+
+
+@dataclass(frozen=True)
+class CpuKind:
+    """A CPU kind returned by :py:meth:`CpuKinds.partition`."""
+
+    rank: int
+    """Position in the partition, 0 for the most performant kind."""
+    index: int
+    """Index of the kind in hwloc, -1 if the topology has no CPU kind information."""
+    cpuset: Bitmap
+    """CPUs of this kind."""
+    efficiency: int
+    """Efficiency of the kind reported by hwloc, -1 if unknown. Higher values are more
+    performant."""
+    infos: dict[str, str]
+    """Info attributes of the kind, like ``CoreType`` or ``FrequencyMaxMHz``."""
+
+    @property
+    def core_type(self) -> str | None:
+        """The ``CoreType`` info, like ``IntelCore`` or ``IntelAtom``."""
+        return self.infos.get("CoreType")
+
+    @property
+    def frequency_max_mhz(self) -> int | None:
+        """The ``FrequencyMaxMHz`` info."""
+        return _parse_int(self.infos.get("FrequencyMaxMHz"))
+
+    @property
+    def frequency_base_mhz(self) -> int | None:
+        """The ``FrequencyBaseMHz`` info."""
+        return _parse_int(self.infos.get("FrequencyBaseMHz"))
+
 
 class CpuKinds(_TopoRefMixin):
     """Represents the CPU kinds in hwloc. Use the
@@ -65,6 +124,7 @@ class CpuKinds(_TopoRefMixin):
         _core.cpukinds_register(
             self._topo.native_handle, cpuset.native_handle, forced_efficiency, infos_arg
         )
+        self._topo._modified(objects=False)
 
     @_reuse_doc(_core.cpukinds_get_nr)
     def n_kinds(self) -> int:
@@ -95,5 +155,38 @@ class CpuKinds(_TopoRefMixin):
 
         return cpuset, efficiency, infos_d
 
+    def partition(self, *, allowed: bool = True) -> list[CpuKind]:
+        """Rank the CPU kinds from the most performant to the most energy efficient.
+        The kinds are ordered by the efficiency reported by hwloc, then by the maximum
+        frequency when the efficiency is unknown.
+
+        Parameters
+        ----------
+        allowed :
+            Only keep the allowed CPUs of each kind, kinds without any allowed CPU are
+            skipped.
+
+        Returns
+        -------
+        A list of disjoint kinds. If the topology has no CPU kind information, a single
+        kind covering all the CPUs is returned.
+        """
+        topo = self._topo
+        mask = topo.allowed_cpuset if allowed else topo.cpuset
+        kinds = []
+        for i in range(self.n_kinds()):
+            cpuset, efficiency, infos = self.get_info(i)
+            kinds.append((i, cpuset & mask, efficiency, infos))
+        if not kinds:
+            kinds.append((-1, copy(mask), -1, {}))
+
+        def key(kind: tuple[int, Bitmap, int, dict[str, str]]) -> tuple[int, int, int]:
+            i, _, efficiency, infos = kind
+            freq = _parse_int(infos.get("FrequencyMaxMHz")) or 0
+            return (-efficiency, -freq, i)
+
+        kinds = [k for k in sorted(kinds, key=key) if not k[1].is_zero()]
+        return [CpuKind(r, *kind) for r, kind in enumerate(kinds)]
+
     def __deepcopy__(self, memo: dict) -> CpuKinds:
         raise RuntimeError("The CpuKinds class cannot be deep-copied.")
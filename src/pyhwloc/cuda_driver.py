@@ -14,11 +14,12 @@ from .bitmap import Bitmap
 from .hwloc import cudadr as _cudadr
 from .hwobject import OsDevice, PciDevice
 from .topology import Topology
-from .utils import PciId, _reuse_doc, _TopoRefMixin
+from .utils import DeviceLocality, PciId, _reuse_doc, _TopoRefMixin
 
 __all__ = [
     "Device",
     "get_device",
+    "get_all_devices",
 ]
 
 
@@ -149,3 +150,24 @@ def get_device(topology: Topology, device: int | CUdevice) -> Device:
         return Device.from_idx(weakref.ref(topology), device)
     else:
         return Device.from_native_handle(weakref.ref(topology), device)
+
+
+def get_all_devices(topology: Topology) -> list[DeviceLocality]:
+    """Get the locality of all CUDA driver devices in one native call. The result is
+    cached by the topology until it's modified.
+
+    Parameters
+    ----------
+    topology :
+        Hardware topology, loaded with OS devices
+
+    """
+
+    def count() -> int:
+        import cuda.bindings.driver as cuda
+
+        status, n = cuda.cuDeviceGetCount()
+        _cudadr._check_cu(status)
+        return n
+
+    return topology._get_all_devices("cuda_driver", count, _cudadr.get_devices)
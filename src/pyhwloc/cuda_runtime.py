@@ -14,7 +14,7 @@ from .bitmap import Bitmap
 from .hwloc import cudart as _cudart
 from .hwobject import OsDevice, PciDevice
 from .topology import Topology
-from .utils import PciId, _reuse_doc, _TopoRefMixin
+from .utils import DeviceLocality, PciId, _reuse_doc, _TopoRefMixin
 
 if TYPE_CHECKING:
     from .utils import _TopoRef
@@ -22,6 +22,7 @@ if TYPE_CHECKING:
 __all__ = [
     "Device",
     "get_device",
+    "get_all_devices",
 ]
 
 
@@ -108,3 +109,24 @@ def get_device(topology: Topology, device: int) -> Device:
 
     """
     return Device.from_idx(weakref.ref(topology), device)
+
+
+def get_all_devices(topology: Topology) -> list[DeviceLocality]:
+    """Get the locality of all CUDA runtime devices in one native call. The result is
+    cached by the topology until it's modified.
+
+    Parameters
+    ----------
+    topology :
+        Hwloc topology, loaded with OS devices.
+
+    """
+
+    def count() -> int:
+        import cuda.bindings.runtime as cudart
+
+        status, n = cudart.cudaGetDeviceCount()
+        _cudart._check_cudart(status)
+        return n
+
+    return topology._get_all_devices("cuda_runtime", count, _cudart.get_devices)
@@ -0,0 +1,249 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+"""
+Topology Differences
+====================
+
+Differences between two topologies, see :py:meth:`~pyhwloc.topology.Topology.diff`.
+hwloc can only represent changes of object attributes (memory size, name and info
+attributes). Structural changes like hot-plugged devices are reported as
+:py:attr:`TopologyDiffType.TOO_COMPLEX` entries, which locate the first object where
+the topologies diverge.
+
+.. code-block::
+
+    with Topology.from_xml_file("old.xml") as old, Topology() as new:
+        with old.diff(new) as diff:
+            for entry in diff:
+                print(entry)
+            if not diff.is_too_complex:
+                diff.apply(old)
+
+"""
+
+from __future__ import annotations
+
+import logging
+import os
+from dataclasses import dataclass
+from types import TracebackType
+from typing import TYPE_CHECKING, Iterator, Type, TypeAlias
+
+from .hwloc import core as _core
+
+if TYPE_CHECKING:
+    from .topology import Topology
+
+__all__ = [
+    "TopologyDiffType",
+    "TopologyDiffObjAttrType",
+    "DiffEntry",
+    "TopologyDiff",
+]
+
+TopologyDiffType: TypeAlias = _core.TopologyDiffType
+TopologyDiffObjAttrType: TypeAlias = _core.TopologyDiffObjAttrType
+
+
+@dataclass(frozen=True)
+class DiffEntry:
+    """An element of a :py:class:`TopologyDiff`. The object is located by its depth
+    and logical index in the first topology, use
+    :py:meth:`~pyhwloc.topology.Topology.get_obj_by_depth` to retrieve it.
+
+    """
+
+    type: TopologyDiffType
+    obj_depth: int
+    obj_index: int
+    attr_type: TopologyDiffObjAttrType | None = None
+    """Type of the modified attribute, None for ``TOO_COMPLEX`` entries."""
+    name: str | None = None
+    """Name of the info attribute for ``INFO`` entries."""
+    oldvalue: int | str | None = None
+    """Value in the first topology, an integer for ``SIZE`` entries."""
+    newvalue: int | str | None = None
+    """Value in the second topology."""
+
+
+def _decode(value: bytes | None) -> str | None:
+    return value.decode("utf-8") if value is not None else None
+
+
+def _entries(hdl: _core.TopologyDiffPtr | None) -> list[DiffEntry]:
+    entries: list[DiffEntry] = []
+    ptr = hdl
+    while ptr:
+        diff = ptr.contents
+        typ = TopologyDiffType(diff.generic.type)
+        if typ == TopologyDiffType.TOO_COMPLEX:
+            tc = diff.too_complex
+            entries.append(DiffEntry(typ, tc.obj_depth, tc.obj_index))
+        else:
+            oa = diff.obj_attr
+            attr_type = TopologyDiffObjAttrType(oa.diff.generic.type)
+            if attr_type == TopologyDiffObjAttrType.SIZE:
+                u = oa.diff.uint64
+                entry = DiffEntry(
+                    typ,
+                    oa.obj_depth,
+                    oa.obj_index,
+                    attr_type,
+                    None,
+                    u.oldvalue,
+                    u.newvalue,
+                )
+            else:
+                s = oa.diff.string
+                is_info = attr_type == TopologyDiffObjAttrType.INFO
+                name = _decode(s.name) if is_info else None
+                entry = DiffEntry(
+                    typ,
+                    oa.obj_depth,
+                    oa.obj_index,
+                    attr_type,
+                    name,
+                    _decode(s.oldvalue),
+                    _decode(s.newvalue),
+                )
+            entries.append(entry)
+        ptr = diff.generic.next
+    return entries
+
+
+class TopologyDiff:
+    """A list of differences between two topologies. The list is owned by this class
+    and freed by :py:meth:`destroy`, when the class is garbage collected, or when
+    leaving the context manager. It doesn't reference the topologies it was built
+    from.
+
+    Use :py:meth:`~pyhwloc.topology.Topology.diff`, :py:meth:`from_xml_file` or
+    :py:meth:`from_xml_buffer` to create a diff, user should not use the constructor.
+
+    """
+
+    def __init__(
+        self, hdl: _core.TopologyDiffPtr | None, refname: str | None = None
+    ) -> None:
+        # NULL if the topologies are identical.
+        self._hdl = hdl
+        self._entries = _entries(hdl)
+        self._destroyed = False
+        self.refname = refname
+        """Identifier of the reference topology stored in the XML, if any."""
+
+    @classmethod
+    def from_xml_file(cls, path: os.PathLike | str) -> TopologyDiff:
+        """Load a diff exported by :py:meth:`export_xml_file`."""
+        path = os.fspath(os.path.expanduser(path))
+        return cls(*_core.topology_diff_load_xml(path))
+
+    @classmethod
+    def from_xml_buffer(cls, xml_buffer: str) -> TopologyDiff:
+        """Load a diff exported by :py:meth:`export_xml_buffer`."""
+        return cls(*_core.topology_diff_load_xmlbuffer(xml_buffer))
+
+    @property
+    def native_handle(self) -> _core.TopologyDiffPtr | None:
+        """The first element of the list, None if there's no difference."""
+        if self._destroyed:
+            raise RuntimeError("The diff has been destroyed.")
+        return self._hdl
+
+    @property
+    def entries(self) -> list[DiffEntry]:
+        """Elements of the diff, in the order of the list."""
+        return list(self._entries)
+
+    @property
+    def is_too_complex(self) -> bool:
+        """Whether some differences cannot be represented. Such diffs cannot be
+        applied."""
+        return any(e.type == TopologyDiffType.TOO_COMPLEX for e in self._entries)
+
+    def __iter__(self) -> Iterator[DiffEntry]:
+        return iter(self.entries)
+
+    def __len__(self) -> int:
+        return len(self._entries)
+
+    def apply(self, topology: Topology, *, reverse: bool = False) -> None:
+        """Apply the diff to a topology with
+        :py:func:`~pyhwloc.hwloc.core.topology_diff_apply`. Applying a diff built by
+        ``old.diff(new)`` to ``old`` makes its attributes identical to ``new``. Objects
+        obtained from the topology are kept and return the new attributes. Nothing is
+        modified if any element cannot be applied.
+
+        Parameters
+        ----------
+        topology :
+            The topology to modify, it must be identical to the first topology, or to
+            the second one if reversed.
+        reverse :
+            Apply the diff in the reverse direction.
+        """
+        hdl = self.native_handle
+        if self.is_too_complex:
+            raise ValueError("The diff is too complex to be applied.")
+        if hdl is None:
+            return
+        flags = _core.TopologyDiffApplyFlags.REVERSE if reverse else 0
+        _core.topology_diff_apply(topology.native_handle, hdl, flags)
+        topology._modified(objects=False)
+
+    def export_xml_buffer(self, refname: str | None = None) -> str:
+        """Export the diff to an XML string with
+        :py:func:`~pyhwloc.hwloc.core.topology_diff_export_xmlbuffer`. Diffs that are
+        too complex cannot be exported.
+
+        Parameters
+        ----------
+        refname :
+            Identifier of the reference topology, usually the name of its XML file.
+        """
+        return _core.topology_diff_export_xmlbuffer(self.native_handle, refname)
+
+    def export_xml_file(
+        self, path: os.PathLike | str, refname: str | None = None
+    ) -> None:
+        """Export the diff to an XML file, see :py:meth:`export_xml_buffer`."""
+        path = os.fspath(os.path.expanduser(path))
+        _core.topology_diff_export_xml(self.native_handle, refname, path)
+
+    def destroy(self) -> None:
+        """Free the list of differences. No-op if it's already destroyed."""
+        if self._destroyed:
+            return
+        if self._hdl is not None:
+            _core.topology_diff_destroy(self._hdl)
+            self._hdl = None
+        self._destroyed = True
+
+    def __enter__(self) -> TopologyDiff:
+        return self
+
+    def __exit__(
+        self,
+        exc_type: Type[BaseException] | None,
+        exc_val: BaseException | None,
+        exc_tb: TracebackType | None,
+    ) -> None:
+        self.destroy()
+
+    def __del__(self) -> None:
+        try:
+            self.destroy()
+        except Exception as e:
+            logging.warning(str(e))
+
+    def __copy__(self) -> TopologyDiff:
+        raise RuntimeError("The TopologyDiff class cannot be copied.")
+
+    def __deepcopy__(self, memo: dict) -> TopologyDiff:
+        raise RuntimeError("The TopologyDiff class cannot be copied.")
+
+    def __repr__(self) -> str:
+        return (
+            f"TopologyDiff(n_entries={len(self._entries)}, "
+            f"too_complex={self.is_too_complex})"
+        )
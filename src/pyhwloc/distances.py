@@ -14,11 +14,12 @@ introduction to the basic concepts.
 from __future__ import annotations
 
 import ctypes
+import weakref
 from typing import TYPE_CHECKING
 
 from .hwloc import core as _core
 from .hwobject import Object
-from .utils import _reuse_doc, _TopoRefMixin
+from .utils import _reuse_doc, _TopoRefMixin, memoryview_from_memory
 
 if TYPE_CHECKING:
     from .utils import _TopoRef
@@ -46,6 +47,9 @@ class Distances(_TopoRefMixin):
             dist = topo.get_disances()
             d = dist[0, 1]
 
+    The class also supports the buffer protocol for accessing the whole matrix without
+    copying, see :py:meth:`as_array`.
+
     """
 
     def __init__(self, hdl: _core.DistancesPtr, topo: _TopoRef) -> None:
@@ -54,6 +58,8 @@ class Distances(_TopoRefMixin):
 
         self._hdl = hdl
         self._topo_ref = topo
+        # Views returned by `as_array`, they are released along with the handle.
+        self._views: list[weakref.ReferenceType[memoryview]] = []
 
     @property
     def native_handle(self) -> _core.DistancesPtr:
@@ -125,6 +131,38 @@ class Distances(_TopoRefMixin):
         flat_idx = _ravel(nbobjs, iidx, jidx)
         return float(hdl.contents.values[flat_idx])
 
+    def as_array(self) -> memoryview:
+        """Get a read-only view of the distance values without copying. The view has
+        the format of uint64 with the same shape as the matrix. It can be consumed by
+        NumPy for vectorized operations:
+
+        .. code-block:: python
+
+            import numpy as np
+
+            values = np.asarray(dist.as_array())
+            nearest = values.argmin(axis=1)
+
+        The view refers to memory owned by hwloc, and is released along with this
+        distances object when the topology is destroyed. Arrays created from the view
+        must be deleted before that.
+
+        """
+        hdl = self.native_handle
+        nbobjs = self.nbobjs
+        itemsize = ctypes.sizeof(_core.hwloc_uint64_t)
+        ptr = ctypes.cast(hdl.contents.values, ctypes.c_void_p)
+        mv = memoryview_from_memory(ptr, nbobjs * nbobjs * itemsize, True)
+        view = mv.cast("Q", self.shape)
+        mv.release()
+
+        self._views = [ref for ref in self._views if ref() is not None]
+        self._views.append(weakref.ref(view))
+        return view
+
+    def __buffer__(self, flags: int) -> memoryview:
+        return self.as_array()
+
     # Iteration Protocols
     def __str__(self) -> str:
         name = self.name or "<unnamed>"
@@ -173,6 +211,20 @@ class Distances(_TopoRefMixin):
         # `distances_release_remove` does. We are doing this workaround just to be safe,
         # in case of the topology is actually used in the future.
         if hasattr(self, "_hdl"):
+            # Invalidate the views before freeing the values so that nobody can read
+            # the memory after release.
+            for ref in getattr(self, "_views", []):
+                view = ref()
+                if view is None:
+                    continue
+                try:
+                    view.release()
+                except BufferError as e:
+                    raise RuntimeError(
+                        "The distance matrix is still being used by an exported "
+                        "buffer, delete arrays created from `as_array` first."
+                    ) from e
+            self._views = []
             # If the _hdl is here, then topology must be valid.
             _core.distances_release(self._topo.native_handle, self._hdl)
             del self._hdl
@@ -0,0 +1,402 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+"""
+Topology-Aware Executor
+=======================
+
+A :py:class:`concurrent.futures.Executor` whose worker threads are bound to topology
+domains (cores, caches, NUMA nodes, ...). Each domain has its own task queue, idle
+workers steal tasks from the closest domains first.
+
+.. code-block::
+
+    with Topology() as topo:
+        with TopologyExecutor(topo, domain=ObjType.NUMANODE) as executor:
+            # Runs on one of the CPUs of the first NUMA node, unless the task is stolen.
+            fut = executor.submit_to(0, sum, range(10))
+            # Runs on the most performant CPU kind of a hybrid CPU.
+            fut = executor.submit_to_kind(0, sum, range(10))
+
+"""
+
+from __future__ import annotations
+
+import itertools
+import logging
+import threading
+import weakref
+from collections import deque
+from concurrent.futures import Executor, Future
+from copy import copy
+from dataclasses import replace
+from typing import TYPE_CHECKING, Callable, ParamSpec, TypeVar
+
+from .bitmap import Bitmap
+from .cpukinds import CpuKind
+from .hwobject import Object, ObjType
+
+if TYPE_CHECKING:
+    from .topology import Topology
+
+__all__ = ["TopologyExecutor"]
+
+_P = ParamSpec("_P")
+_R = TypeVar("_R")
+
+
+class _WorkItem:
+    def __init__(
+        self,
+        future: Future,
+        fn: Callable,
+        args: tuple,
+        kwargs: dict,
+        kind: int | None = None,
+    ) -> None:
+        self.future = future
+        self.fn = fn
+        self.args = args
+        self.kwargs = kwargs
+        # Rank of the CPU kind required by the task, if any.
+        self.kind = kind
+        # Submission order, set by the scheduler.
+        self.seq = 0
+
+    def run(self) -> None:
+        if not self.future.set_running_or_notify_cancel():
+            return
+        try:
+            result = self.fn(*self.args, **self.kwargs)
+        except BaseException as exc:
+            self.future.set_exception(exc)
+        else:
+            self.future.set_result(result)
+
+
+class _Scheduler:
+    # State shared by the workers. It doesn't reference the executor so that an
+    # unreachable executor can be finalized.
+    def __init__(self, domain_kinds: list[int], steal_order: list[list[int]]) -> None:
+        n = len(domain_kinds)
+        self.domain_kinds = domain_kinds
+        self.steal_order = steal_order
+        # Tasks bound to a CPU kind are kept apart so that they don't prevent other
+        # workers from stealing the plain tasks queued before them. The kind of these
+        # tasks is always the one of the domain. Items are numbered to keep the
+        # submission order across both queues.
+        self.queues: list[deque[_WorkItem]] = [deque() for _ in range(n)]
+        self.kind_queues: list[deque[_WorkItem]] = [deque() for _ in range(n)]
+        self.seq = itertools.count()
+        self.lock = threading.Lock()
+        # One condition per domain, all sharing the lock, so that a task only wakes a
+        # single worker.
+        self.conds = [threading.Condition(self.lock) for _ in range(n)]
+        # Number of waiting workers of each domain that haven't been notified yet.
+        self.idle = [0] * n
+        self.shutdown = False
+
+    def pop(self, idx: int) -> _WorkItem | None:
+        # Called with the lock held.
+        plain, bound = self.queues[idx], self.kind_queues[idx]
+        if plain or bound:
+            # Oldest task first.
+            if not bound or (plain and plain[0].seq < bound[0].seq):
+                return plain.popleft()
+            return bound.popleft()
+        kind = self.domain_kinds[idx]
+        for other in self.steal_order[idx]:
+            plain = self.queues[other]
+            bound = self.kind_queues[other]
+            if not bound or self.domain_kinds[other] != kind:
+                if plain:
+                    return plain.pop()
+                continue
+            # Newest eligible task first.
+            if not plain or bound[-1].seq > plain[-1].seq:
+                return bound.pop()
+            return plain.pop()
+        return None
+
+    def get(self, idx: int) -> _WorkItem | None:
+        """Wait for a task for the worker of a domain, None after shutdown."""
+        with self.lock:
+            item = self.pop(idx)
+            while item is None:
+                if self.shutdown:
+                    return None
+                self.idle[idx] += 1
+                self.conds[idx].wait()
+                item = self.pop(idx)
+        return item
+
+    def push(self, domain: int, item: _WorkItem) -> None:
+        with self.lock:
+            if self.shutdown:
+                raise RuntimeError("Cannot submit after shutdown.")
+            item.seq = next(self.seq)
+            if item.kind is None:
+                self.queues[domain].append(item)
+            else:
+                self.kind_queues[domain].append(item)
+            # Wake an idle worker of the domain, or the closest idle thief if all the
+            # workers of the domain are busy.
+            target = domain if self.idle[domain] else None
+            if target is None:
+                kind = item.kind
+                for other in self.steal_order[domain]:
+                    if self.idle[other] and kind in (None, self.domain_kinds[other]):
+                        target = other
+                        break
+            if target is not None:
+                # Notified workers are no longer counted as idle, so that the next
+                # task wakes another one.
+                self.idle[target] -= 1
+                self.conds[target].notify()
+
+    def close(self, cancel_futures: bool = False) -> None:
+        with self.lock:
+            self.shutdown = True
+            if cancel_futures:
+                for queue in self.queues + self.kind_queues:
+                    while queue:
+                        queue.popleft().future.cancel()
+            for cond in self.conds:
+                cond.notify_all()
+            self.idle = [0] * len(self.idle)
+
+
+def _worker(
+    scheduler: _Scheduler,
+    topology: Topology,
+    cpuset: Bitmap,
+    idx: int,
+    ready: threading.Semaphore,
+    errors: dict[int, Exception],
+) -> None:
+    try:
+        topology.set_thread_cpubind(threading.get_ident(), cpuset)
+    except Exception as e:
+        errors[idx] = e
+    finally:
+        ready.release()
+    # The topology is not used after binding.
+    del topology
+
+    while True:
+        item = scheduler.get(idx)
+        if item is None:
+            return
+        item.run()
+        # Release the reference before waiting for the next task.
+        del item
+
+
+class TopologyExecutor(Executor):
+    """Thread pool executor with workers bound to topology domains. Use it as a context
+    manager or call :py:meth:`shutdown` to stop the workers. The workers are also
+    stopped when the executor is garbage collected.
+
+    Parameters
+    ----------
+    topology :
+        A loaded topology of this system. It's only used for binding the workers during
+        construction.
+    domain :
+        Type of the objects used as domains. Each worker is bound to the cpuset of its
+        domain. Use :py:attr:`~pyhwloc.hwobject.ObjType.CORE` (default) for one worker
+        per core, or a cache/NUMA/package type for one worker per domain that can run
+        anywhere inside the domain.
+    workers_per_domain :
+        Number of worker threads for each domain.
+    work_stealing :
+        Whether idle workers can run tasks queued for other domains. Tasks submitted to
+        a CPU kind are only stolen by workers of the same kind.
+    strict_binding :
+        Raise the error of the first worker that fails to bind to its domain. Otherwise,
+        the failures are logged and the unbound workers keep running, see
+        :py:attr:`unbound_domains`.
+
+    """
+
+    def __init__(
+        self,
+        topology: Topology,
+        domain: ObjType = ObjType.CORE,
+        *,
+        workers_per_domain: int = 1,
+        work_stealing: bool = True,
+        strict_binding: bool = True,
+    ) -> None:
+        if workers_per_domain < 1:
+            raise ValueError("`workers_per_domain` must be at least 1.")
+
+        allowed = topology.allowed_cpuset
+        objs, cpusets = [], []
+        for obj in topology.iter_objs_by_type(domain):
+            cpuset = obj.cpuset
+            if cpuset is None:
+                continue
+            cpuset &= allowed
+            if not cpuset.is_zero():
+                objs.append(obj)
+                cpusets.append(cpuset)
+        if not cpusets:
+            raise ValueError(f"No object of type {domain.name} with allowed CPUs.")
+
+        self._domains = cpusets
+        self._kinds = topology.get_cpukinds().partition()
+        # Rank of the CPU kind containing each domain, -1 for domains spanning several
+        # kinds.
+        self._domain_kinds = [
+            next((k.rank for k in self._kinds if d.is_included(k.cpuset)), -1)
+            for d in cpusets
+        ]
+        self._steal_order = (
+            _steal_order(objs) if work_stealing else [[] for _ in cpusets]
+        )
+        self._scheduler = _Scheduler(self._domain_kinds, self._steal_order)
+        self._rr = itertools.count()
+
+        self._threads: list[threading.Thread] = []
+        ready = threading.Semaphore(0)
+        errors: dict[int, Exception] = {}
+        for i, _ in itertools.product(range(len(cpusets)), range(workers_per_domain)):
+            t = threading.Thread(
+                target=_worker,
+                args=(self._scheduler, topology, cpusets[i], i, ready, errors),
+                name=f"pyhwloc-{domain.name.lower()}-{i}",
+                daemon=True,
+            )
+            t.start()
+            self._threads.append(t)
+        # Stop the workers if the executor is collected without a shutdown.
+        self._finalizer = weakref.finalize(self, self._scheduler.close)
+        # Wait for all workers to be bound so that the topology can be released
+        # afterward.
+        for _ in self._threads:
+            ready.acquire()
+
+        self._unbound = sorted(errors)
+        if errors and strict_binding:
+            self.shutdown()
+            idx = self._unbound[0]
+            raise errors[idx]
+        for idx in self._unbound:
+            logging.warning(f"Failed to bind the worker of domain {idx}: {errors[idx]}")
+
+    @property
+    def domains(self) -> list[Bitmap]:
+        """Cpuset of each domain, indexed by the domain index used in
+        :py:meth:`submit_to`."""
+        return [copy(d) for d in self._domains]
+
+    @property
+    def unbound_domains(self) -> list[int]:
+        """Indices of the domains with workers that failed to bind, only non-empty if
+        `strict_binding` is False."""
+        return list(self._unbound)
+
+    @property
+    def kinds(self) -> list[CpuKind]:
+        """CPU kinds of the allowed CPUs, see
+        :py:meth:`~pyhwloc.cpukinds.CpuKinds.partition`."""
+        return [replace(k, cpuset=copy(k.cpuset)) for k in self._kinds]
+
+    def domains_of_kind(self, kind: int) -> list[int]:
+        """Indices of the domains included in a CPU kind.
+
+        Parameters
+        ----------
+        kind :
+            Rank of the kind in :py:attr:`kinds`, 0 for the most performant kind.
+        """
+        return [i for i, k in enumerate(self._domain_kinds) if k == kind]
+
+    @property
+    def n_workers(self) -> int:
+        """Total number of worker threads."""
+        return len(self._threads)
+
+    def submit_to(
+        self, domain: int, fn: Callable[_P, _R], /, *args: _P.args, **kwargs: _P.kwargs
+    ) -> Future[_R]:
+        """Submit a task to the queue of a specific domain.
+
+        Parameters
+        ----------
+        domain :
+            Index of the domain, see :py:attr:`domains`.
+        """
+        if not 0 <= domain < len(self._domains):
+            raise IndexError(f"Invalid domain index: {domain}")
+        item = _WorkItem(Future(), fn, args, kwargs)
+        self._scheduler.push(domain, item)
+        return item.future
+
+    def submit_to_kind(
+        self, kind: int, fn: Callable[_P, _R], /, *args: _P.args, **kwargs: _P.kwargs
+    ) -> Future[_R]:
+        """Submit a task to the domains of a CPU kind, like the performance cores of a
+        hybrid CPU. Domains of the kind are chosen in a round-robin fashion, and the
+        task is never stolen by workers of other kinds.
+
+        Parameters
+        ----------
+        kind :
+            Rank of the kind in :py:attr:`kinds`, 0 for the fastest available kind. The
+            domains spanning several kinds are not eligible, see
+            :py:meth:`domains_of_kind`.
+        """
+        domains = self.domains_of_kind(kind)
+        if not domains:
+            raise ValueError(f"No domain is included in the CPU kind {kind}.")
+        domain = domains[next(self._rr) % len(domains)]
+        item = _WorkItem(Future(), fn, args, kwargs, kind)
+        self._scheduler.push(domain, item)
+        return item.future
+
+    def submit(
+        self, fn: Callable[_P, _R], /, *args: _P.args, **kwargs: _P.kwargs
+    ) -> Future[_R]:
+        """Submit a task, domains are chosen in a round-robin fashion."""
+        domain = next(self._rr) % len(self._domains)
+        return self.submit_to(domain, fn, *args, **kwargs)
+
+    def shutdown(self, wait: bool = True, *, cancel_futures: bool = False) -> None:
+        self._scheduler.close(cancel_futures)
+        self._finalizer.detach()
+        if wait:
+            for t in self._threads:
+                t.join()
+
+    def __repr__(self) -> str:
+        n_domains = len(self._domains)
+        return f"TopologyExecutor(domains={n_domains}, workers={self.n_workers})"
+
+
+def _steal_order(objs: list[Object]) -> list[list[int]]:
+    # Order the other domains of each domain by the depth of their common ancestor,
+    # deeper is closer, then by index. The domains below each ancestor are collected
+    # in a single walk up from each domain.
+    ancestors: list[list[int]] = []
+    below: dict[int, list[int]] = {}
+    for i, obj in enumerate(objs):
+        chain = []
+        parent = obj.parent
+        while parent is not None:
+            chain.append(parent.gp_index)
+            below.setdefault(parent.gp_index, []).append(i)
+            parent = parent.parent
+        ancestors.append(chain)
+
+    result = []
+    for i, chain in enumerate(ancestors):
+        seen = {i}
+        order = []
+        for gp_index in chain:
+            for other in below[gp_index]:
+                if other not in seen:
+                    seen.add(other)
+                    order.append(other)
+        result.append(order)
+    return result
@@ -10,7 +10,15 @@ from __future__ import annotations
 import ctypes
 from typing import Callable
 
-from .lib import _LIB, HwLocError, _cfndoc, _checkc, _hwloc_error
+from .lib import (
+    _LIB,
+    HwLocError,
+    _cfndoc,
+    _checkc,
+    _hwloc_error,
+    _pyhwloc_lib,
+    _use_fastpath,
+)
 from .libc import free as cfree
 from .libc import strerror as cstrerror
 
@@ -382,6 +390,28 @@ def bitmap_nr_ulongs(bitmap: const_bitmap_t) -> int:
     return _LIB.hwloc_bitmap_nr_ulongs(bitmap)
 
 
+_pyhwloc_lib.pyhwloc_bitmap_to_indices.argtypes = [
+    const_bitmap_t,
+    ctypes.POINTER(ctypes.c_uint),
+    ctypes.c_uint,
+]
+_pyhwloc_lib.pyhwloc_bitmap_to_indices.restype = ctypes.c_int
+
+
+def bitmap_to_indices(
+    bitmap: const_bitmap_t, indices: ctypes._Pointer | None, max_indices: int
+) -> int:
+    """Write the indices of set bits into `indices` with a single call, this is a
+    pyhwloc extension. At most `max_indices` are written. Returns the number of set
+    bits, pass 0 to `max_indices` to query the required size.
+
+    """
+    weight = _pyhwloc_lib.pyhwloc_bitmap_to_indices(bitmap, indices, max_indices)
+    if weight < 0:
+        raise ValueError("Cannot export indices of an infinite bitmap.")
+    return weight
+
+
 _LIB.hwloc_bitmap_isset.argtypes = [const_bitmap_t, ctypes.c_uint]
 _LIB.hwloc_bitmap_isset.restype = ctypes.c_int
 
@@ -535,6 +565,38 @@ def bitmap_not(res: bitmap_t, bitmap: const_bitmap_t) -> None:
     _checkc(_LIB.hwloc_bitmap_not(res, bitmap))
 
 
+_pyhwloc_lib.pyhwloc_bitmap_reduce_or.argtypes = [
+    bitmap_t,
+    ctypes.POINTER(const_bitmap_t),
+    ctypes.c_uint,
+]
+_pyhwloc_lib.pyhwloc_bitmap_reduce_or.restype = ctypes.c_int
+
+
+def bitmap_reduce_or(res: bitmap_t, bitmaps: ctypes.Array, n: int) -> None:
+    """Store the union of the `n` bitmaps in `bitmaps` into `res` with a single call,
+    this is a pyhwloc extension. `res` is emptied if `n` is 0.
+
+    """
+    _checkc(_pyhwloc_lib.pyhwloc_bitmap_reduce_or(res, bitmaps, n))
+
+
+_pyhwloc_lib.pyhwloc_bitmap_reduce_and.argtypes = [
+    bitmap_t,
+    ctypes.POINTER(const_bitmap_t),
+    ctypes.c_uint,
+]
+_pyhwloc_lib.pyhwloc_bitmap_reduce_and.restype = ctypes.c_int
+
+
+def bitmap_reduce_and(res: bitmap_t, bitmaps: ctypes.Array, n: int) -> None:
+    """Store the intersection of the `n` bitmaps in `bitmaps` into `res` with a single
+    call, this is a pyhwloc extension. `res` is filled if `n` is 0.
+
+    """
+    _checkc(_pyhwloc_lib.pyhwloc_bitmap_reduce_and(res, bitmaps, n))
+
+
 # Comparing bitmaps
 _LIB.hwloc_bitmap_intersects.argtypes = [const_bitmap_t, const_bitmap_t]
 _LIB.hwloc_bitmap_intersects.restype = ctypes.c_int
@@ -579,3 +641,20 @@ _LIB.hwloc_bitmap_compare.restype = ctypes.c_int
 @_cfndoc
 def bitmap_compare(bitmap1: const_bitmap_t, bitmap2: const_bitmap_t) -> int:
     return _LIB.hwloc_bitmap_compare(bitmap1, bitmap2)
+
+
+# Replace the hottest functions with the native extension when it's built.
+_use_fastpath(
+    globals(),
+    [
+        "bitmap_isset",
+        "bitmap_iszero",
+        "bitmap_weight",
+        "bitmap_first",
+        "bitmap_next",
+        "bitmap_last",
+        "bitmap_intersects",
+        "bitmap_isincluded",
+        "bitmap_isequal",
+    ],
+)
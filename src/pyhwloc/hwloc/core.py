@@ -18,16 +18,23 @@ from .lib import (
     _LIB,
     HwLocError,
     _cenumdoc,
+    _buffer_ptr,
     _cfndoc,
     _checkc,
     _cstructdoc,
     _cuniondoc,
     _hwloc_error,
+    _fastpath,
     _PrintableStruct,
     _pyhwloc_lib,
+    _use_fastpath,
 )
+from .libc import free as _cfree
 from .libc import strerror as _strerror
 
+if TYPE_CHECKING:
+    from collections.abc import Buffer
+
 hwloc_uint64_t = ctypes.c_uint64
 HWLOC_UNKNOWN_INDEX = ctypes.c_uint(-1).value
 
@@ -1252,11 +1259,24 @@ _LIB.hwloc_topology_set_xmlbuffer.restype = ctypes.c_int
 
 
 @_cfndoc
-def topology_set_xmlbuffer(topology: topology_t, buf: str) -> None:
-    buffer_bytes = buf.encode("utf-8")
-    _checkc(
-        _LIB.hwloc_topology_set_xmlbuffer(topology, buffer_bytes, len(buffer_bytes))
-    )
+def topology_set_xmlbuffer(topology: topology_t, buf: str | Buffer) -> None:
+    # Apart from strings, the buffer is passed to hwloc without any copy. This includes
+    # `bytes`, `memoryview` and `mmap.mmap` of an XML file.
+    def check_size(size: int) -> None:
+        # hwloc takes the size as an `int`.
+        if size >= 2**31:
+            raise ValueError("The XML buffer must be smaller than 2GB.")
+
+    if isinstance(buf, str):
+        buf = buf.encode("utf-8")
+    if isinstance(buf, bytes):
+        check_size(len(buf))
+        _checkc(_LIB.hwloc_topology_set_xmlbuffer(topology, buf, len(buf)))
+        return
+    with _buffer_ptr(buf) as (addr, size):
+        check_size(size)
+        ptr = ctypes.cast(addr, ctypes.c_char_p)
+        _checkc(_LIB.hwloc_topology_set_xmlbuffer(topology, ptr, size))
 
 
 _LIB.hwloc_topology_set_components.argtypes = [
@@ -2508,7 +2528,7 @@ _LIB.hwloc_free_xmlbuffer.restype = None
 
 
 # This function is only used internally since we return python strings.
-def _free_xmlbuffer(topology: topology_t, xmlbuffer: ctypes.c_char_p) -> None:
+def _free_xmlbuffer(topology: topology_t | None, xmlbuffer: ctypes.c_char_p) -> None:
     _LIB.hwloc_free_xmlbuffer(topology, xmlbuffer)
 
 
@@ -3481,6 +3501,270 @@ def cpukinds_register(
     )
 
 
+######################
+# Topology differences
+######################
+
+# https://www.open-mpi.org/projects/hwloc/doc/v2.12.0/a00189.php
+
+
+@_cenumdoc("hwloc_topology_diff_obj_attr_type_e")
+class TopologyDiffObjAttrType(IntEnum):
+    SIZE = 0
+    NAME = 1
+    INFO = 2
+
+
+@_cstructdoc(
+    "hwloc_topology_diff_obj_attr_generic_s", parent="hwloc_topology_diff_obj_attr_u"
+)
+class TopologyDiffObjAttrGeneric(_PrintableStruct):
+    _fields_ = [
+        ("type", ctypes.c_int),  # hwloc_topology_diff_obj_attr_type_t
+    ]
+
+
+@_cstructdoc(
+    "hwloc_topology_diff_obj_attr_uint64_s", parent="hwloc_topology_diff_obj_attr_u"
+)
+class TopologyDiffObjAttrUint64(_PrintableStruct):
+    _fields_ = [
+        ("type", ctypes.c_int),  # hwloc_topology_diff_obj_attr_type_t
+        ("index", hwloc_uint64_t),  # not used for SIZE
+        ("oldvalue", hwloc_uint64_t),
+        ("newvalue", hwloc_uint64_t),
+    ]
+
+
+@_cstructdoc(
+    "hwloc_topology_diff_obj_attr_string_s", parent="hwloc_topology_diff_obj_attr_u"
+)
+class TopologyDiffObjAttrString(_PrintableStruct):
+    _fields_ = [
+        ("type", ctypes.c_int),  # hwloc_topology_diff_obj_attr_type_t
+        ("name", ctypes.c_char_p),  # not used for NAME
+        ("oldvalue", ctypes.c_char_p),
+        ("newvalue", ctypes.c_char_p),
+    ]
+
+
+@_cuniondoc("hwloc_topology_diff_obj_attr_u")
+class TopologyDiffObjAttrU(ctypes.Union):
+    _fields_ = [
+        ("generic", TopologyDiffObjAttrGeneric),
+        ("uint64", TopologyDiffObjAttrUint64),
+        ("string", TopologyDiffObjAttrString),
+    ]
+
+
+@_cenumdoc("hwloc_topology_diff_type_e")
+class TopologyDiffType(IntEnum):
+    OBJ_ATTR = 0
+    TOO_COMPLEX = 1
+
+
+@_cuniondoc("hwloc_topology_diff_u")
+class TopologyDiffU(ctypes.Union):
+    pass
+
+
+topology_diff_t = ctypes.POINTER(TopologyDiffU)
+
+
+@_cstructdoc("hwloc_topology_diff_generic_s", parent="hwloc_topology_diff_u")
+class TopologyDiffGeneric(_PrintableStruct):
+    _fields_ = [
+        ("type", ctypes.c_int),  # hwloc_topology_diff_type_t
+        ("next", topology_diff_t),
+    ]
+
+
+@_cstructdoc("hwloc_topology_diff_obj_attr_s", parent="hwloc_topology_diff_u")
+class TopologyDiffObjAttr(_PrintableStruct):
+    _fields_ = [
+        ("type", ctypes.c_int),  # hwloc_topology_diff_type_t
+        ("next", topology_diff_t),
+        ("obj_depth", ctypes.c_int),
+        ("obj_index", ctypes.c_uint),
+        ("diff", TopologyDiffObjAttrU),
+    ]
+
+
+@_cstructdoc("hwloc_topology_diff_too_complex_s", parent="hwloc_topology_diff_u")
+class TopologyDiffTooComplex(_PrintableStruct):
+    _fields_ = [
+        ("type", ctypes.c_int),  # hwloc_topology_diff_type_t
+        ("next", topology_diff_t),
+        ("obj_depth", ctypes.c_int),
+        ("obj_index", ctypes.c_uint),
+    ]
+
+
+TopologyDiffU._fields_ = [
+    ("generic", TopologyDiffGeneric),
+    ("obj_attr", TopologyDiffObjAttr),
+    ("too_complex", TopologyDiffTooComplex),
+]
+
+
+if TYPE_CHECKING:
+    TopologyDiffPtr = ctypes._Pointer[TopologyDiffU]
+else:
+    TopologyDiffPtr = ctypes._Pointer
+
+
+_LIB.hwloc_topology_diff_build.argtypes = [
+    topology_t,
+    topology_t,
+    ctypes.c_ulong,
+    ctypes.POINTER(topology_diff_t),
+]
+_LIB.hwloc_topology_diff_build.restype = ctypes.c_int
+
+
+@_cfndoc
+def topology_diff_build(
+    topology: topology_t, newtopology: topology_t
+) -> TopologyDiffPtr | None:
+    diff = topology_diff_t()
+    # flags must be 0 for now. A status of 1 means the list contains a
+    # ``TOO_COMPLEX`` entry, it still needs to be destroyed.
+    status = _LIB.hwloc_topology_diff_build(
+        topology, newtopology, 0, ctypes.byref(diff)
+    )
+    if status < 0:
+        _checkc(status)
+    if not diff:
+        return None
+    return diff
+
+
+@_cenumdoc("hwloc_topology_diff_apply_flags_e")
+class TopologyDiffApplyFlags(IntEnum):
+    REVERSE = 1 << 0
+
+
+_LIB.hwloc_topology_diff_apply.argtypes = [topology_t, topology_diff_t, ctypes.c_ulong]
+_LIB.hwloc_topology_diff_apply.restype = ctypes.c_int
+
+
+@_cfndoc
+def topology_diff_apply(
+    topology: topology_t, diff: TopologyDiffPtr, flags: int
+) -> None:
+    # Returns -N if the N-th element cannot be applied, previous elements are
+    # reverted.
+    _checkc(_LIB.hwloc_topology_diff_apply(topology, diff, flags))
+
+
+_LIB.hwloc_topology_diff_destroy.argtypes = [topology_diff_t]
+_LIB.hwloc_topology_diff_destroy.restype = ctypes.c_int
+
+
+@_cfndoc
+def topology_diff_destroy(diff: TopologyDiffPtr) -> None:
+    _checkc(_LIB.hwloc_topology_diff_destroy(diff))
+
+
+def _take_refname(refname: ctypes.c_char_p) -> str | None:
+    if not refname:
+        return None
+    result = refname.value.decode("utf-8") if refname.value else ""
+    _cfree(refname)
+    return result
+
+
+_LIB.hwloc_topology_diff_load_xml.argtypes = [
+    ctypes.c_char_p,
+    ctypes.POINTER(topology_diff_t),
+    ctypes.POINTER(ctypes.c_char_p),
+]
+_LIB.hwloc_topology_diff_load_xml.restype = ctypes.c_int
+
+
+@_cfndoc
+def topology_diff_load_xml(xmlpath: str) -> tuple[TopologyDiffPtr | None, str | None]:
+    diff = topology_diff_t()
+    refname = ctypes.c_char_p()
+    _checkc(
+        _LIB.hwloc_topology_diff_load_xml(
+            xmlpath.encode("utf-8"), ctypes.byref(diff), ctypes.byref(refname)
+        )
+    )
+    return (diff if diff else None), _take_refname(refname)
+
+
+_LIB.hwloc_topology_diff_export_xml.argtypes = [
+    topology_diff_t,
+    ctypes.c_char_p,
+    ctypes.c_char_p,
+]
+_LIB.hwloc_topology_diff_export_xml.restype = ctypes.c_int
+
+
+@_cfndoc
+def topology_diff_export_xml(
+    diff: TopologyDiffPtr | None, refname: str | None, xmlpath: str
+) -> None:
+    ref = refname.encode("utf-8") if refname is not None else None
+    _checkc(_LIB.hwloc_topology_diff_export_xml(diff, ref, xmlpath.encode("utf-8")))
+
+
+_LIB.hwloc_topology_diff_load_xmlbuffer.argtypes = [
+    ctypes.c_char_p,
+    ctypes.c_int,
+    ctypes.POINTER(topology_diff_t),
+    ctypes.POINTER(ctypes.c_char_p),
+]
+_LIB.hwloc_topology_diff_load_xmlbuffer.restype = ctypes.c_int
+
+
+@_cfndoc
+def topology_diff_load_xmlbuffer(
+    xmlbuffer: str,
+) -> tuple[TopologyDiffPtr | None, str | None]:
+    diff = topology_diff_t()
+    refname = ctypes.c_char_p()
+    buffer_bytes = xmlbuffer.encode("utf-8")
+    # The length includes the ending \0.
+    _checkc(
+        _LIB.hwloc_topology_diff_load_xmlbuffer(
+            buffer_bytes,
+            len(buffer_bytes) + 1,
+            ctypes.byref(diff),
+            ctypes.byref(refname),
+        )
+    )
+    return (diff if diff else None), _take_refname(refname)
+
+
+_LIB.hwloc_topology_diff_export_xmlbuffer.argtypes = [
+    topology_diff_t,
+    ctypes.c_char_p,
+    ctypes.POINTER(ctypes.c_char_p),
+    ctypes.POINTER(ctypes.c_int),
+]
+_LIB.hwloc_topology_diff_export_xmlbuffer.restype = ctypes.c_int
+
+
+@_cfndoc
+def topology_diff_export_xmlbuffer(
+    diff: TopologyDiffPtr | None, refname: str | None
+) -> str:
+    ref = refname.encode("utf-8") if refname is not None else None
+    xmlbuffer = ctypes.c_char_p()
+    buflen = ctypes.c_int()
+    _checkc(
+        _LIB.hwloc_topology_diff_export_xmlbuffer(
+            diff, ref, ctypes.byref(xmlbuffer), ctypes.byref(buflen)
+        )
+    )
+    result = xmlbuffer.value.decode("utf-8") if xmlbuffer.value else ""
+    # The buffer doesn't belong to any topology.
+    _free_xmlbuffer(None, xmlbuffer)
+    return result
+
+
 ######################################
 # Sharing topologies between processes
 ######################################
@@ -3489,6 +3773,57 @@ def cpukinds_register(
 
 # Not implemented.
 
+#################
+# Batched queries
+#################
+
+# These are pyhwloc extensions implemented in `src/ext/pyhwloc.c` instead of hwloc
+# functions. They fill flat arrays in a single call to avoid one ctypes round trip per
+# object.
+
+
+class LevelSnapshot(_PrintableStruct):
+    """Column pointers for :py:func:`snapshot_level`, mirrors the
+    ``pyhwloc_level_snapshot_s`` struct. Columns set to NULL are skipped.
+
+    """
+
+    _fields_ = [
+        ("os_index", ctypes.POINTER(ctypes.c_uint)),
+        ("logical_index", ctypes.POINTER(ctypes.c_uint)),
+        ("gp_index", ctypes.POINTER(hwloc_uint64_t)),
+        ("parent_gp_index", ctypes.POINTER(hwloc_uint64_t)),  # -1 for the root
+        ("cpuset_first", ctypes.POINTER(ctypes.c_int)),  # -1 if there's no cpuset
+        ("cpuset_last", ctypes.POINTER(ctypes.c_int)),
+        ("cpuset_weight", ctypes.POINTER(ctypes.c_int)),
+        ("nodeset_first", ctypes.POINTER(ctypes.c_int)),
+    ]
+
+
+_pyhwloc_lib.pyhwloc_snapshot_level.argtypes = [
+    topology_t,
+    ctypes.c_int,
+    ctypes.POINTER(LevelSnapshot),
+    ctypes.c_uint,
+]
+_pyhwloc_lib.pyhwloc_snapshot_level.restype = ctypes.c_int
+
+
+def snapshot_level(
+    topology: topology_t, depth: int, snapshot: LevelSnapshot, max_objs: int
+) -> int:
+    """Fill the columns of `snapshot` for at most `max_objs` objects at `depth`.
+    Returns the number of objects written.
+
+    """
+    n = _pyhwloc_lib.pyhwloc_snapshot_level(
+        topology, depth, ctypes.byref(snapshot), max_objs
+    )
+    if n < 0:
+        raise _hwloc_error("pyhwloc_snapshot_level")
+    return n
+
+
 ###########
 # Utilities
 ###########
@@ -3498,3 +3833,29 @@ def is_same_obj(a: ctypes._Pointer, b: ctypes._Pointer) -> bool:
     return (
         ctypes.cast(a, ctypes.c_void_p).value == ctypes.cast(b, ctypes.c_void_p).value
     )
+
+
+###########
+# Fast path
+###########
+
+# Replace the hottest query functions with the native extension when it's built.
+if _fastpath is not None:
+    _fastpath._init(obj_t)
+_use_fastpath(
+    globals(),
+    [
+        "get_type_depth",
+        "get_nbobjs_by_depth",
+        "get_nbobjs_by_type",
+        "get_root_obj",
+        "get_obj_by_depth",
+        "get_obj_by_type",
+        "get_next_obj_by_depth",
+        "get_next_obj_by_type",
+        "get_pu_obj_by_os_index",
+        "get_numanode_obj_by_os_index",
+        "get_ancestor_obj_by_depth",
+        "get_ancestor_obj_by_type",
+    ],
+)
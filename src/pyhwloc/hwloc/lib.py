@@ -4,10 +4,14 @@ from __future__ import annotations
 
 import ctypes
 import errno
+import importlib.util
 import os
 import sys
+import sysconfig
+from contextlib import contextmanager
 from ctypes.util import find_library
-from typing import Any, Callable, ParamSpec, Type, TypeVar
+from types import ModuleType
+from typing import Any, Callable, Iterator, ParamSpec, Sequence, Type, TypeVar
 
 from .libc import strerror as cstrerror
 
@@ -60,7 +64,85 @@ else:
     _LIB = ctypes.CDLL(_hwloc_lib_name, mode=ctypes.RTLD_GLOBAL, use_errno=True)
 
 
-_pyhwloc_lib = ctypes.cdll.LoadLibrary(os.path.join(_lib_path, _get_libname("pyhwloc")))
+# The extension reports errors through errno as well. `use_errno` makes ctypes save it
+# for each thread right after the call.
+_pyhwloc_lib = ctypes.CDLL(
+    os.path.join(_lib_path, _get_libname("pyhwloc")), use_errno=True
+)
+
+
+def _load_fastpath() -> ModuleType | None:
+    # The optional CPython extension, built with the `PYHWLOC_BUILD_FASTPATH` CMake
+    # option. Set `PYHWLOC_DISABLE_FASTPATH=1` to use ctypes for all functions.
+    if os.environ.get("PYHWLOC_DISABLE_FASTPATH", "0") not in ("", "0"):
+        return None
+    # The extension uses the limited API, which is not available on free-threaded
+    # builds.
+    if sysconfig.get_config_var("Py_GIL_DISABLED"):
+        return None
+    suffix = ".pyd" if _IS_WINDOWS else ".so"
+    path = os.path.join(_lib_path, f"_fastpath{suffix}")
+    if not os.path.exists(path):
+        return None
+    spec = importlib.util.spec_from_file_location("pyhwloc._lib._fastpath", path)
+    assert spec is not None and spec.loader is not None
+    module = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(module)
+    return module
+
+
+_fastpath = _load_fastpath()
+
+
+def _use_fastpath(namespace: dict[str, Any], names: Sequence[str]) -> None:
+    """Replace the ctypes wrappers in a module namespace with the functions of the
+    native extension, if it's available."""
+    if _fastpath is None:
+        return
+    for name in names:
+        namespace[name] = getattr(_fastpath, name)
+
+
+class _PyBuffer(ctypes.Structure):
+    # The `Py_buffer` struct of the buffer protocol, part of the stable ABI.
+    _fields_ = [
+        ("buf", ctypes.c_void_p),
+        ("obj", ctypes.c_void_p),
+        ("len", ctypes.c_ssize_t),
+        ("itemsize", ctypes.c_ssize_t),
+        ("readonly", ctypes.c_int),
+        ("ndim", ctypes.c_int),
+        ("format", ctypes.c_void_p),
+        ("shape", ctypes.c_void_p),
+        ("strides", ctypes.c_void_p),
+        ("suboffsets", ctypes.c_void_p),
+        ("internal", ctypes.c_void_p),
+    ]
+
+
+ctypes.pythonapi.PyObject_GetBuffer.argtypes = [
+    ctypes.py_object,
+    ctypes.POINTER(_PyBuffer),
+    ctypes.c_int,
+]
+ctypes.pythonapi.PyObject_GetBuffer.restype = ctypes.c_int
+ctypes.pythonapi.PyBuffer_Release.argtypes = [ctypes.POINTER(_PyBuffer)]
+ctypes.pythonapi.PyBuffer_Release.restype = None
+
+
+@contextmanager
+def _buffer_ptr(obj: Any) -> Iterator[tuple[ctypes.c_void_p, int]]:
+    """Get the address and the size of a contiguous buffer without copying it. Unlike
+    :py:meth:`ctypes.c_char.from_buffer`, read-only buffers like :py:class:`bytes`
+    and read-only :py:class:`mmap.mmap` are accepted. The buffer is locked, a
+    :py:class:`mmap.mmap` cannot be closed until the context exits."""
+    view = _PyBuffer()
+    # PyBUF_SIMPLE, raises BufferError for non-contiguous buffers.
+    ctypes.pythonapi.PyObject_GetBuffer(obj, ctypes.byref(view), 0)
+    try:
+        yield ctypes.c_void_p(view.buf), view.len
+    finally:
+        ctypes.pythonapi.PyBuffer_Release(ctypes.byref(view))
 
 
 class HwLocError(RuntimeError):
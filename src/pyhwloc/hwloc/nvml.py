@@ -12,7 +12,14 @@ import os
 
 import pynvml
 
-from .core import ObjPtr, _checkc, hwloc_cpuset_t, obj_t, topology_t
+from .core import (
+    ObjPtr,
+    _checkc,
+    hwloc_cpuset_t,
+    hwloc_nodeset_t,
+    obj_t,
+    topology_t,
+)
 from .lib import _IS_DOC_BUILD, _c_prefix_fndoc, _get_libname, _lib_path
 
 #####################################################
@@ -23,8 +30,8 @@ from .lib import _IS_DOC_BUILD, _c_prefix_fndoc, _get_libname, _lib_path
 # https://www.open-mpi.org/projects/hwloc/doc/v2.12.1/a00179.php
 
 if not _IS_DOC_BUILD:
-    _pyhwloc_nvml_lib = ctypes.cdll.LoadLibrary(
-        os.path.join(_lib_path, _get_libname("pyhwloc_nvml"))
+    _pyhwloc_nvml_lib = ctypes.CDLL(
+        os.path.join(_lib_path, _get_libname("pyhwloc_nvml")), use_errno=True
     )
 
     _pyhwloc_nvml_lib.pyhwloc_nvml_get_device_cpuset.argtypes = [
@@ -74,3 +81,50 @@ def get_device_osdev(
     if not dev_obj:
         return None
     return dev_obj
+
+
+if not _IS_DOC_BUILD:
+    _pyhwloc_nvml_lib.pyhwloc_nvml_get_devices.argtypes = [
+        topology_t,
+        ctypes.c_uint,  # number of devices
+        ctypes.POINTER(hwloc_cpuset_t),  # cpusets
+        ctypes.POINTER(hwloc_nodeset_t),  # nodesets
+        ctypes.POINTER(ctypes.c_int),  # PCI domain, bus and dev of each device
+        ctypes.POINTER(obj_t),  # OS devices
+    ]
+    _pyhwloc_nvml_lib.pyhwloc_nvml_get_devices.restype = ctypes.c_int
+
+
+def get_devices(
+    topology: topology_t,
+    n: int,
+    cpusets: ctypes.Array,
+    nodesets: ctypes.Array,
+    pci_ids: ctypes.Array,
+    osdevs: ctypes.Array,
+) -> None:
+    """Get the locality of the first `n` NVML devices in one call. NVML must be
+    initialized. This is a pyhwloc extension.
+
+    Parameters
+    ----------
+    topology :
+        The topology object.
+    n :
+        Number of devices, starting from the ordinal 0.
+    cpusets :
+        Array of `n` allocated cpusets, filled with the CPUs close to each device.
+    nodesets :
+        Array of `n` allocated nodesets, filled with the NUMA nodes close to each
+        device.
+    pci_ids :
+        Array of `3 * n` ints, filled with the PCI domain, bus and dev of each device.
+    osdevs :
+        Array of `n` object pointers, filled with the OS device of each device, or NULL
+        if the OS device is not in the topology.
+    """
+    _checkc(
+        _pyhwloc_nvml_lib.pyhwloc_nvml_get_devices(
+            topology, n, cpusets, nodesets, pci_ids, osdevs
+        )
+    )
@@ -7,11 +7,12 @@ Interoperability with Python sched affinity
 
 from __future__ import annotations
 
+import ctypes
+
 from .bitmap import (
     bitmap_alloc,
-    bitmap_first,
-    bitmap_next,
     bitmap_set,
+    bitmap_to_indices,
 )
 from .core import (
     hwloc_const_cpuset_t,
@@ -31,12 +32,10 @@ from .core import (
 
 def cpuset_to_sched_affinity(cpuset: hwloc_const_cpuset_t) -> set[int]:
     """Convert the bitmap to the Python sched affinity set."""
-    idx = bitmap_first(cpuset)
-    affinity = set()
-    while idx != -1:
-        affinity.add(idx)
-        idx = bitmap_next(cpuset, idx)
-    return affinity
+    n = bitmap_to_indices(cpuset, None, 0)
+    indices = (ctypes.c_uint * n)()
+    bitmap_to_indices(cpuset, indices, n)
+    return set(indices)
 
 
 def cpuset_from_sched_affinity(affinity: set[int]) -> hwloc_cpuset_t:
@@ -11,10 +11,20 @@ Python interface of the hwloc_obj type.
 from __future__ import annotations
 
 import ctypes
+import functools
 from copy import copy
 from dataclasses import dataclass
 from enum import IntEnum
-from typing import TYPE_CHECKING, Iterator, Protocol, TypeAlias, cast
+from typing import (
+    TYPE_CHECKING,
+    Any,
+    Callable,
+    Iterator,
+    Protocol,
+    TypeAlias,
+    TypeVar,
+    cast,
+)
 
 from .bitmap import Bitmap
 from .hwloc import core as _core
@@ -121,10 +131,40 @@ class PciDevAttr(_PciDevAttr):
         return self._attr
 
 
+_T = TypeVar("_T")
+
+
+def _memoized(fn: Callable[[Object], _T]) -> Callable[[Object], _T]:
+    # Cache a field of the object. The topology doesn't change after load unless it's
+    # modified, in which case the topology clears the memo, see `Topology._modified`.
+    # Mutable values are copied so that callers can't alter the memo.
+    name = fn.__name__
+
+    @functools.wraps(fn)
+    def getter(self: Object) -> _T:
+        memo = self._memo
+        if name in memo:
+            # Raise if the topology is no longer valid.
+            _ = self.native_handle
+            value = memo[name]
+        else:
+            value = memo[name] = fn(self)
+        if isinstance(value, (Bitmap, dict, list)):
+            return cast(_T, copy(value))
+        return value
+
+    return getter
+
+
 class Object(_TopoRefMixin):
     """High-level interface for the hwloc object. Only the topology can return
     objects. User should not use the constructor.
 
+    Objects are unique within a topology, the same hwloc object is always represented
+    by the same Python object, and the fields are cached after the first access. Both
+    are reset when the topology is modified by methods like
+    :py:meth:`~pyhwloc.topology.Topology.restrict`.
+
     Parameters
     ----------
     hdl :
@@ -136,6 +176,7 @@ class Object(_TopoRefMixin):
         assert hdl
         self._hdl = hdl
         self._topo_ref = topology
+        self._memo: dict[str, Any] = {}
 
     @property
     def native_handle(self) -> _core.ObjPtr:
@@ -145,11 +186,13 @@ class Object(_TopoRefMixin):
         return self._hdl
 
     @property
+    @_memoized
     def type(self) -> ObjType:
         """Type of object."""
         return ObjType(self.native_handle.contents.type)
 
     @property
+    @_memoized
     def subtype(self) -> str | None:
         """Subtype string to better describe the type field."""
         if self.native_handle.contents.subtype:
@@ -157,11 +200,13 @@ class Object(_TopoRefMixin):
         return None
 
     @property
+    @_memoized
     def os_index(self) -> int:
         """OS-provided physical index number."""
         return self.native_handle.contents.os_index
 
     @property
+    @_memoized
     def name(self) -> str | None:
         """Object-specific name if any."""
         if self.native_handle.contents.name:
@@ -169,6 +214,7 @@ class Object(_TopoRefMixin):
         return None
 
     @property
+    @_memoized
     def total_memory(self) -> int:
         """Total memory (in bytes) in NUMA nodes below this object."""
         return self.native_handle.contents.total_memory
@@ -279,11 +325,13 @@ class Object(_TopoRefMixin):
     # - End accessors for attr
 
     @property
+    @_memoized
     def depth(self) -> int:
         """Vertical index in the hierarchy."""
         return self.native_handle.contents.depth
 
     @property
+    @_memoized
     def logical_index(self) -> int:
         """Horizontal index in the whole list of similar objects."""
         return self.native_handle.contents.logical_index
@@ -303,6 +351,7 @@ class Object(_TopoRefMixin):
         return None
 
     @property
+    @_memoized
     def parent(self) -> Object | None:
         """Parent object, None if root (Machine object)."""
         if self.native_handle.contents.parent:
@@ -310,6 +359,7 @@ class Object(_TopoRefMixin):
         return None
 
     @property
+    @_memoized
     def sibling_rank(self) -> int:
         """Index in parent's children array."""
         return self.native_handle.contents.sibling_rank
@@ -329,11 +379,13 @@ class Object(_TopoRefMixin):
         return None
 
     @property
+    @_memoized
     def arity(self) -> int:
         """Number of normal children."""
         return self.native_handle.contents.arity
 
     @property
+    @_memoized
     def children(self) -> list[Object]:
         """Normal children. Memory, Misc and I/O children are not listed here."""
         ptr_children = self.native_handle.contents.children
@@ -363,6 +415,7 @@ class Object(_TopoRefMixin):
         return bool(self.native_handle.contents.symmetric_subtree)
 
     @property
+    @_memoized
     def memory_arity(self) -> int:
         """Number of Memory children."""
         return self.native_handle.contents.memory_arity
@@ -377,6 +430,7 @@ class Object(_TopoRefMixin):
         return None
 
     @property
+    @_memoized
     def io_arity(self) -> int:
         """Number of I/O children."""
         return self.native_handle.contents.io_arity
@@ -389,6 +443,7 @@ class Object(_TopoRefMixin):
         return None
 
     @property
+    @_memoized
     def misc_arity(self) -> int:
         """Number of Misc children."""
         return self.native_handle.contents.misc_arity
@@ -401,12 +456,14 @@ class Object(_TopoRefMixin):
         return None
 
     @property
+    @_memoized
     def cpuset(self) -> Bitmap | None:
         """CPUs covered by this object."""
         cpuset = self.native_handle.contents.cpuset
         return copy(Bitmap.from_native_handle(cpuset, own=False)) if cpuset else None
 
     @property
+    @_memoized
     def complete_cpuset(self) -> Bitmap | None:
         """The complete CPU set of processors of this object."""
         complete_cpuset = self.native_handle.contents.complete_cpuset
@@ -417,12 +474,14 @@ class Object(_TopoRefMixin):
         )
 
     @property
+    @_memoized
     def nodeset(self) -> Bitmap | None:
         """NUMA nodes covered by this object or containing this object."""
         nodeset = self.native_handle.contents.nodeset
         return copy(Bitmap.from_native_handle(nodeset, own=False)) if nodeset else None
 
     @property
+    @_memoized
     def complete_nodeset(self) -> Bitmap | None:
         """The complete NUMA node set of this object."""
         complete_nodeset = self.native_handle.contents.complete_nodeset
@@ -433,6 +492,7 @@ class Object(_TopoRefMixin):
         )
 
     @property
+    @_memoized
     def info(self) -> dict[str, str]:
         """Get the object info."""
         infos = self.native_handle.contents.infos
@@ -443,10 +503,12 @@ class Object(_TopoRefMixin):
     @_reuse_doc(_core.obj_add_info)
     def add_info(self, name: str, value: str) -> None:
         _core.obj_add_info(self.native_handle, name, value)
+        self._topo._modified(objects=False)
 
     # void *userdata
 
     @property
+    @_memoized
     def gp_index(self) -> int:
         "Global persistent index."
         return int(self.native_handle.contents.gp_index)
@@ -748,7 +810,20 @@ def compare_types(type1: ObjType | Object, type2: ObjType | Object) -> ObjTypeCm
 
 
 def _object(hdl: _core.ObjPtr, topology: _TopoRef) -> Object:
+    # Look up the identity map of the topology first.
     assert hdl
+    topo = topology()
+    if topo is None:
+        return _new_object(hdl, topology)
+    gp_index = hdl.contents.gp_index
+    obj = topo._objects.get(gp_index)
+    if obj is None:
+        # Keep the first one if another thread created the same object concurrently.
+        obj = topo._objects.setdefault(gp_index, _new_object(hdl, topology))
+    return obj
+
+
+def _new_object(hdl: _core.ObjPtr, topology: _TopoRef) -> Object:
     attr = hdl.contents.attr
     if not attr:
         return Object(hdl, topology)
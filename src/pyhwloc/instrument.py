@@ -0,0 +1,319 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+"""
+Instrumentation
+===============
+
+Opt-in call counters and latency histograms for the low-level interface. Two layers
+are recorded for each call:
+
+- ``python``: the wrappers in :doc:`pyhwloc.hwloc </low_level>`, like
+  ``core.set_cpubind``, including the argument conversion done by ctypes and the error
+  handling.
+- ``ffi``: the foreign functions exported by hwloc and the pyhwloc extension, like
+  ``hwloc_set_cpubind``. It covers the work done by hwloc along with the system calls.
+
+The difference between the two layers for the same call is the overhead of the Python
+layer. Functions implemented by the :ref:`native fast path <build-fastpath>` are only
+recorded in the ``python`` layer. Instrumentation replaces the functions with timed ones
+when enabled and restores them when disabled, there's no overhead when it's disabled. It
+can also be enabled at import time with the ``PYHWLOC_INSTRUMENT=1`` environment
+variable.
+
+.. code-block::
+
+    from pyhwloc import instrument
+
+    with instrument.instrumented():
+        with Topology() as topo:
+            topo.set_cpubind({0})
+    for name, s in instrument.stats().items():
+        print(name, s.layer, s.count, s.mean_ns)
+    print(instrument.to_prometheus())
+
+"""
+
+from __future__ import annotations
+
+import ctypes
+import inspect
+import os
+import sys
+import threading
+from contextlib import contextmanager
+from dataclasses import dataclass
+from time import perf_counter_ns
+from types import ModuleType
+from typing import Any, Callable, Iterator
+
+__all__ = [
+    "BUCKET_BOUNDS_NS",
+    "CallStats",
+    "enable",
+    "disable",
+    "is_enabled",
+    "instrumented",
+    "reset",
+    "stats",
+    "to_prometheus",
+    "register_opentelemetry",
+]
+
+_N_BUCKETS = 20
+BUCKET_BOUNDS_NS = tuple(1 << (i + 8) for i in range(_N_BUCKETS))
+"""Upper bounds (exclusive) of the histogram buckets in nanoseconds, from 256 ns to
+about 134 ms. Calls that take longer are counted in an extra bucket."""
+
+# Modules of the low-level interface, only those that have been imported are
+# instrumented.
+_MODULES = (
+    "pyhwloc.hwloc.core",
+    "pyhwloc.hwloc.bitmap",
+    "pyhwloc.hwloc.linux",
+    "pyhwloc.hwloc.windows",
+    "pyhwloc.hwloc.sched",
+    "pyhwloc.hwloc.cudadr",
+    "pyhwloc.hwloc.cudart",
+    "pyhwloc.hwloc.nvml",
+)
+
+
+@dataclass(frozen=True)
+class CallStats:
+    """Statistics of a function, see :py:func:`stats`."""
+
+    name: str
+    """Name of the function, the C symbol for the ``ffi`` layer."""
+    layer: str
+    """Either ``python`` or ``ffi``, see the module documentation."""
+    count: int
+    """Number of calls."""
+    total_ns: int
+    """Cumulative latency in nanoseconds."""
+    buckets: tuple[int, ...]
+    """Number of calls in each bucket of :py:data:`BUCKET_BOUNDS_NS`, plus the calls
+    that exceed the last bound. The counts are not cumulative."""
+
+    @property
+    def mean_ns(self) -> float:
+        """Average latency in nanoseconds."""
+        return self.total_ns / self.count if self.count else 0.0
+
+
+class _Counter:
+    __slots__ = ("name", "layer", "count", "total_ns", "buckets")
+
+    def __init__(self, name: str, layer: str) -> None:
+        self.name = name
+        self.layer = layer
+        self.count = 0
+        self.total_ns = 0
+        self.buckets = [0] * (_N_BUCKETS + 1)
+
+    def add(self, ns: int) -> None:
+        idx = min(max(ns.bit_length() - 8, 0), _N_BUCKETS)
+        with _lock:
+            self.count += 1
+            self.total_ns += ns
+            self.buckets[idx] += 1
+
+
+# Reentrant, the garbage collector might run instrumented finalizers while the lock is
+# being held.
+_lock = threading.RLock()
+_counters: dict[str, _Counter] = {}
+# (owner, attribute, original)
+_patched: list[tuple[Any, str, Any]] = []
+
+
+def _counter(name: str, layer: str) -> _Counter:
+    if name not in _counters:
+        _counters[name] = _Counter(name, layer)
+    return _counters[name]
+
+
+def _timed(fn: Callable, counter: _Counter) -> Callable:
+    def wrapper(*args: Any, **kwargs: Any) -> Any:
+        start = perf_counter_ns()
+        try:
+            return fn(*args, **kwargs)
+        finally:
+            counter.add(perf_counter_ns() - start)
+
+    wrapper.__name__ = getattr(fn, "__name__", counter.name)
+    wrapper.__doc__ = fn.__doc__
+    wrapper.__wrapped__ = fn  # type: ignore[attr-defined]
+    return wrapper
+
+
+def _patch(owner: Any, attr: str, fn: Callable, counter: _Counter) -> None:
+    setattr(owner, attr, _timed(fn, counter))
+    _patched.append((owner, attr, fn))
+
+
+def _is_wrapper(mod: ModuleType, name: str, value: Any) -> bool:
+    from .hwloc.lib import _fastpath
+
+    if inspect.isbuiltin(value):
+        # Replaced by the native extension.
+        return getattr(_fastpath, name, None) is value
+    return (
+        inspect.isfunction(value)
+        and value.__module__ == mod.__name__
+        and not inspect.isgeneratorfunction(value)
+    )
+
+
+def _instrument_module(mod: ModuleType, libs: dict[int, ctypes.CDLL]) -> None:
+    short = mod.__name__.rsplit(".", 1)[1]
+    for name, value in list(vars(mod).items()):
+        if isinstance(value, ctypes.CDLL):
+            libs[id(value)] = value
+        if name.startswith("_") or not _is_wrapper(mod, name, value):
+            continue
+        key = f"{short}.{name}"
+        _patch(mod, name, value, _counter(key, "python"))
+
+
+def _instrument_lib(lib: ctypes.CDLL) -> None:
+    # ctypes caches the foreign functions as attributes of the library.
+    for name, value in list(vars(lib).items()):
+        if isinstance(value, ctypes._CFuncPtr):
+            _patch(lib, name, value, _counter(name, "ffi"))
+
+
+def enable() -> None:
+    """Start recording the calls. Modules of the low-level interface imported after
+    this call are not instrumented. No-op if it's already enabled."""
+    # The modules used by the high-level interface.
+    from .hwloc import bitmap, core  # noqa: F401
+
+    with _lock:
+        if _patched:
+            return
+        libs: dict[int, ctypes.CDLL] = {}
+        for name in _MODULES:
+            mod = sys.modules.get(name)
+            if mod is not None:
+                _instrument_module(mod, libs)
+        for lib in libs.values():
+            _instrument_lib(lib)
+
+
+def disable() -> None:
+    """Stop recording the calls and restore the original functions. The statistics are
+    kept until :py:func:`reset` is called."""
+    with _lock:
+        while _patched:
+            owner, attr, fn = _patched.pop()
+            setattr(owner, attr, fn)
+
+
+def is_enabled() -> bool:
+    """Whether the calls are being recorded."""
+    return bool(_patched)
+
+
+@contextmanager
+def instrumented() -> Iterator[None]:
+    """Record the calls within a context. Restore the previous state on exit."""
+    was_enabled = is_enabled()
+    enable()
+    try:
+        yield
+    finally:
+        if not was_enabled:
+            disable()
+
+
+def reset() -> None:
+    """Clear the statistics."""
+    with _lock:
+        for c in _counters.values():
+            c.count = 0
+            c.total_ns = 0
+            c.buckets = [0] * (_N_BUCKETS + 1)
+
+
+def stats() -> dict[str, CallStats]:
+    """Get a snapshot of the statistics for the functions that have been called, sorted
+    by the cumulative latency in descending order.
+
+    The same snapshot is available as :py:func:`pyhwloc.stats`.
+
+    """
+    with _lock:
+        result = [
+            CallStats(c.name, c.layer, c.count, c.total_ns, tuple(c.buckets))
+            for c in _counters.values()
+            if c.count
+        ]
+    result.sort(key=lambda s: s.total_ns, reverse=True)
+    return {s.name: s for s in result}
+
+
+def to_prometheus(snapshot: dict[str, CallStats] | None = None) -> str:
+    """Export the statistics as a histogram in the Prometheus text format.
+
+    Parameters
+    ----------
+    snapshot :
+        Result of :py:func:`stats`, a new snapshot is taken if it's None.
+    """
+    if snapshot is None:
+        snapshot = stats()
+    metric = "pyhwloc_call_duration_seconds"
+    lines = [
+        f"# HELP {metric} Latency of the calls into hwloc.",
+        f"# TYPE {metric} histogram",
+    ]
+    for s in snapshot.values():
+        labels = f'function="{s.name}",layer="{s.layer}"'
+        cumulative = 0
+        for bound, n in zip(BUCKET_BOUNDS_NS, s.buckets):
+            cumulative += n
+            le = f"{bound / 1e9:g}"
+            lines.append(f'{metric}_bucket{{{labels},le="{le}"}} {cumulative}')
+        lines.append(f'{metric}_bucket{{{labels},le="+Inf"}} {s.count}')
+        lines.append(f"{metric}_sum{{{labels}}} {s.total_ns / 1e9:g}")
+        lines.append(f"{metric}_count{{{labels}}} {s.count}")
+    return "\n".join(lines) + "\n"
+
+
+def register_opentelemetry(meter: Any) -> None:
+    """Report the call counts and the cumulative latency through observable counters of
+    an OpenTelemetry meter, named ``pyhwloc.calls`` and ``pyhwloc.call.duration``. The
+    ``opentelemetry-api`` package is required.
+
+    Parameters
+    ----------
+    meter :
+        An :py:class:`opentelemetry.metrics.Meter`.
+    """
+    from opentelemetry.metrics import CallbackOptions, Observation
+
+    def observe(value: Callable[[CallStats], float]) -> Callable:
+        def callback(options: CallbackOptions) -> list[Observation]:
+            return [
+                Observation(value(s), {"function": s.name, "layer": s.layer})
+                for s in stats().values()
+            ]
+
+        return callback
+
+    meter.create_observable_counter(
+        "pyhwloc.calls",
+        callbacks=[observe(lambda s: s.count)],
+        unit="{call}",
+        description="Number of calls into hwloc.",
+    )
+    meter.create_observable_counter(
+        "pyhwloc.call.duration",
+        callbacks=[observe(lambda s: s.total_ns / 1e9)],
+        unit="s",
+        description="Cumulative latency of the calls into hwloc.",
+    )
+
+
+if os.environ.get("PYHWLOC_INSTRUMENT", "0") not in ("", "0"):
+    enable()
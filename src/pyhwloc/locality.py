@@ -0,0 +1,318 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+"""
+Locality Index
+==============
+
+Precomputed lookup tables for answering locality queries without walking the topology,
+see :py:meth:`~pyhwloc.topology.Topology.locality_index` and
+:py:meth:`~pyhwloc.topology.Topology.io_affinity_matrix`.
+
+.. code-block::
+
+    with Topology() as topo:
+        index = topo.locality_index()
+        # Logical index of the NUMA node local to the CPU with OS index 3.
+        node = index.lookup(ObjType.NUMANODE, 3)
+        gpus = index.os_devices(node, ObjOsdevType.GPU)
+
+"""
+
+from __future__ import annotations
+
+import weakref
+from array import array
+from enum import IntEnum
+from typing import TYPE_CHECKING, Sequence
+
+from .hwloc import core as _core
+from .hwobject import (
+    Bridge,
+    ObjBridgeType,
+    Object,
+    ObjOsdevType,
+    ObjType,
+    OsDevice,
+    PciDevice,
+    _object,
+)
+from .utils import _matrix_view, _TopoRefMixin
+
+if TYPE_CHECKING:
+    from .topology import Topology
+
+__all__ = ["LocalityIndex", "IoPathKind", "IoAffinityMatrix"]
+
+
+class LocalityIndex(_TopoRefMixin):
+    """Dense lookup tables mapping the OS index of each PU to the logical index of its
+    enclosing objects, and each NUMA node to its local OS devices. Lookups are plain
+    array accesses. Use :py:meth:`~pyhwloc.topology.Topology.locality_index` to build
+    the index, user should not use the constructor.
+
+    """
+
+    TYPES = (
+        ObjType.CORE,
+        ObjType.L2CACHE,
+        ObjType.L3CACHE,
+        ObjType.NUMANODE,
+        ObjType.PACKAGE,
+    )
+    """Object types with a lookup table."""
+
+    def __init__(self, topology: Topology) -> None:
+        self._topo_ref = weakref.ref(topology)
+
+        size = max((pu.os_index for pu in topology.iter_cpus()), default=-1) + 1
+        self._tables: dict[ObjType, array] = {}
+        for typ in self.TYPES:
+            table = array("i", [-1]) * size
+            for obj in topology.iter_objs_by_type(typ):
+                cpuset = obj.cpuset
+                if cpuset is None:
+                    continue
+                idx = obj.logical_index
+                for pu in cpuset.to_array():
+                    # PUs are shared by NUMA nodes of different kinds, keep the first
+                    # one in logical order.
+                    if pu < size and table[pu] == -1:
+                        table[pu] = idx
+            self._tables[typ] = table
+
+        # NUMA node OS index -> logical index
+        numa_logical = {n.os_index: n.logical_index for n in topology.iter_numa_nodes()}
+        self._os_devices: list[list[OsDevice]] = [[] for _ in numa_logical]
+        hdl = topology.native_handle
+        for dev in topology.iter_os_devices():
+            ancestor = _object(
+                _core.get_non_io_ancestor_obj(hdl, dev.native_handle), self._topo_ref
+            )
+            nodeset = ancestor.nodeset
+            if nodeset is None:
+                continue
+            for os_index in nodeset.to_array():
+                if os_index in numa_logical:
+                    self._os_devices[numa_logical[os_index]].append(dev)
+
+    @property
+    def n_pus(self) -> int:
+        """Size of the tables, the largest OS index of PUs plus one."""
+        return len(self._tables[ObjType.CORE])
+
+    def lookup(self, obj_type: ObjType, pu: int) -> int:
+        """Get the logical index of the object of type `obj_type` that contains the PU
+        with the OS index `pu`.
+
+        Returns
+        -------
+        The logical index, -1 if there's no such object or no such PU.
+        """
+        _ = self._topo
+        table = self._tables[obj_type]
+        if 0 <= pu < len(table):
+            return table[pu]
+        return -1
+
+    def table(self, obj_type: ObjType) -> memoryview:
+        """Get a read-only view of the table for the objects of type `obj_type`,
+        indexed by the OS index of the PUs. The items are C ints, use ``-1`` for PUs
+        that are not covered by any object of the type. The view can be consumed by
+        NumPy without copying.
+
+        """
+        _ = self._topo
+        return memoryview(self._tables[obj_type]).toreadonly()
+
+    def os_devices(self, numa: int, osdev_type: int | None = None) -> list[OsDevice]:
+        """Get the OS devices local to a NUMA node.
+
+        Parameters
+        ----------
+        numa :
+            Logical index of the NUMA node.
+        osdev_type :
+            Only return devices of this type if specified, see
+            :py:class:`~pyhwloc.hwobject.ObjOsdevType`.
+        """
+        _ = self._topo
+        devices = self._os_devices[numa]
+        if osdev_type is None:
+            return list(devices)
+        return [d for d in devices if d.is_osdev_type(osdev_type)]
+
+    def local_os_devices(
+        self, pu: int, osdev_type: int | None = None
+    ) -> list[OsDevice]:
+        """Get the OS devices local to the NUMA node of a PU.
+
+        Parameters
+        ----------
+        pu :
+            OS index of the PU.
+        osdev_type :
+            See :py:meth:`os_devices`.
+        """
+        numa = self.lookup(ObjType.NUMANODE, pu)
+        if numa == -1:
+            return []
+        return self.os_devices(numa, osdev_type)
+
+    def __repr__(self) -> str:
+        return f"LocalityIndex(n_pus={self.n_pus})"
+
+
+class IoPathKind(IntEnum):
+    """Kind of the closest common ancestor of two I/O devices, from the closest to the
+    furthest."""
+
+    SAME_DEVICE = 0
+    """Both OS devices are attached to the same PCI device."""
+    PCI_SWITCH = 1
+    """The path only traverses PCI bridges (switches) and devices."""
+    HOST_BRIDGE = 2
+    """The path traverses a host bridge but stays below it."""
+    PACKAGE = 3
+    """The path traverses the host within a package (socket)."""
+    SYSTEM = 4
+    """The path crosses packages."""
+
+
+def _attachment(dev: OsDevice) -> Object:
+    # OS devices are software handles of the PCI device they are attached to.
+    parent = dev.parent
+    if parent is not None and parent.type == ObjType.PCI_DEVICE:
+        return parent
+    return dev
+
+
+def _linkspeed(obj: Object) -> float:
+    # Speed of the upstream link, 0 if the object doesn't have a PCI link.
+    if isinstance(obj, PciDevice):
+        return float(obj.attr.linkspeed)
+    if isinstance(obj, Bridge) and obj.upstream_type == ObjBridgeType.PCI:
+        return float(obj.attr.upstream.pci.linkspeed)
+    return 0.0
+
+
+class IoAffinityMatrix:
+    """Pairwise affinity between I/O devices. Each matrix is a read-only, 2-dimensional
+    :py:class:`memoryview` indexed by the positions in :py:attr:`devices`, it can be
+    consumed by NumPy without copying. Use
+    :py:meth:`~pyhwloc.topology.Topology.io_affinity_matrix` to build the matrices,
+    user should not use the constructor.
+
+    """
+
+    def __init__(self, devices: list[OsDevice]) -> None:
+        self._devices = devices
+        n = len(devices)
+
+        # Ancestor index of each device: the chain from its attachment to the root,
+        # the position of each ancestor in the chain, and the slowest link between the
+        # attachment and each ancestor.
+        chains: list[list[Object]] = []
+        positions: list[dict[int, int]] = []
+        speeds: list[list[float]] = []
+        for dev in devices:
+            chain: list[Object] = []
+            obj: Object | None = _attachment(dev)
+            while obj is not None:
+                chain.append(obj)
+                obj = obj.parent
+            chains.append(chain)
+            positions.append({o.gp_index: i for i, o in enumerate(chain)})
+            slowest = [0.0]
+            for o in chain[:-1]:
+                speed = _linkspeed(o)
+                prev = slowest[-1]
+                slowest.append(min(prev, speed) if prev and speed else prev or speed)
+            speeds.append(slowest)
+
+        kinds: dict[int, IoPathKind] = {}
+
+        def kind_of(ancestor: Object) -> IoPathKind:
+            gp_index = ancestor.gp_index
+            if gp_index not in kinds:
+                if isinstance(ancestor, Bridge):
+                    host = ancestor.upstream_type == ObjBridgeType.HOST
+                    kind = IoPathKind.HOST_BRIDGE if host else IoPathKind.PCI_SWITCH
+                elif ancestor.is_io():
+                    kind = IoPathKind.PCI_SWITCH
+                elif ancestor.is_package() or ancestor.get_ancestor_obj_by_type(
+                    ObjType.PACKAGE
+                ):
+                    kind = IoPathKind.PACKAGE
+                else:
+                    kind = IoPathKind.SYSTEM
+                kinds[gp_index] = kind
+            return kinds[gp_index]
+
+        self._hops = array("i", [0]) * (n * n)
+        self._kinds = array("i", [0]) * (n * n)
+        self._types = array("i", [0]) * (n * n)
+        self._speeds = array("f", [0.0]) * (n * n)
+        for i in range(n):
+            for j in range(i, n):
+                jb = 0
+                chain_b = chains[j]
+                while chain_b[jb].gp_index not in positions[i]:
+                    jb += 1
+                ancestor = chain_b[jb]
+                ia = positions[i][ancestor.gp_index]
+
+                hops = max(ia + jb - 1, 0)
+                kind = IoPathKind.SAME_DEVICE if ia == jb == 0 else kind_of(ancestor)
+                sa, sb = speeds[i][ia], speeds[j][jb]
+                speed = min(sa, sb) if sa and sb else sa or sb
+                for k in (i * n + j, j * n + i):
+                    self._hops[k] = hops
+                    self._kinds[k] = kind
+                    self._types[k] = ancestor.type
+                    self._speeds[k] = speed
+
+    @property
+    def devices(self) -> list[OsDevice]:
+        """The OS devices, in the order of the rows and columns."""
+        return list(self._devices)
+
+    @property
+    def hops(self) -> memoryview:
+        """Number of objects traversed between the PCI devices of two OS devices, or
+        between the OS devices themselves if they are not attached to PCI devices. Two
+        devices behind the same PCI switch are 1 hop away. C ints."""
+        return _matrix_view(self._hops, len(self), len(self))
+
+    @property
+    def path_kinds(self) -> memoryview:
+        """:py:class:`IoPathKind` of each pair. C ints."""
+        return _matrix_view(self._kinds, len(self), len(self))
+
+    @property
+    def ancestor_types(self) -> memoryview:
+        """:py:class:`~pyhwloc.hwobject.ObjType` of the closest common ancestor of each
+        pair. C ints."""
+        return _matrix_view(self._types, len(self), len(self))
+
+    @property
+    def linkspeed(self) -> memoryview:
+        """The slowest PCI link (in GB/s) on the path of each pair, 0 if there's no
+        known link on the path. C floats."""
+        return _matrix_view(self._speeds, len(self), len(self))
+
+    def __len__(self) -> int:
+        return len(self._devices)
+
+    def __repr__(self) -> str:
+        return f"IoAffinityMatrix(n_devices={len(self._devices)})"
+
+
+def _io_devices(
+    devices: Sequence[OsDevice], kinds: Sequence[ObjOsdevType] | None
+) -> list[OsDevice]:
+    if kinds is None:
+        return list(devices)
+    mask = 0
+    for kind in kinds:
+        mask |= kind
+    return [d for d in devices if d.is_osdev_type(mask)]
@@ -11,14 +11,15 @@ This module provides high-level interfaces for hwloc memory attributes.
 from __future__ import annotations
 
 import ctypes
+from array import array
 from copy import copy
-from typing import TYPE_CHECKING, TypeAlias, Union, overload
+from typing import TYPE_CHECKING, Sequence, TypeAlias, Union, overload
 
 from .bitmap import Bitmap as _Bitmap
 from .hwloc import core as _core
 from .hwobject import Object as _Object
 from .hwobject import _object
-from .utils import _Flags, _or_flags, _reuse_doc, _TopoRefMixin
+from .utils import _Flags, _matrix_view, _or_flags, _reuse_doc, _TopoRefMixin
 
 if TYPE_CHECKING:
     from .utils import _TopoRef
@@ -26,6 +27,7 @@ if TYPE_CHECKING:
 __all__ = [
     "MemAttr",
     "MemAttrs",
+    "MemAttrTable",
     "MemAttrFlag",
     "LocalNumaNodeFlag",
     "MemAttrId",
@@ -36,6 +38,7 @@ LocalNumaNodeFlag: TypeAlias = _core.LocalNumaNodeFlag
 MemAttrId: TypeAlias = _core.MemAttrId
 
 _Initiator: TypeAlias = Union[_Object, _Bitmap, set[int]]
+_AttrId: TypeAlias = Union[str, int, _core.MemAttrId]
 
 
 @overload
@@ -170,6 +173,7 @@ class MemAttr(_TopoRefMixin):
             ctypes.byref(initiator_loc) if initiator_loc is not None else None,
             value,
         )
+        self._topo._modified(objects=False)
 
     @_reuse_doc(_core.memattr_get_best_target)
     def get_best_target(
@@ -308,6 +312,145 @@ class MemAttr(_TopoRefMixin):
         return self.native_handle.value == other.native_handle.value
 
 
+def _initiator_key(initiator: _Bitmap | _Object) -> tuple[str, int | str]:
+    # hwloc doesn't match object initiators with cpuset initiators, neither do we.
+    if isinstance(initiator, _Object):
+        return ("object", initiator.gp_index)
+    return ("cpuset", initiator.to_string())
+
+
+class MemAttrTable(_TopoRefMixin):
+    """Dense initiator x target matrices of memory attribute values, built by
+    :py:meth:`MemAttrs.build_table`. Targets are the NUMA nodes of the topology.
+
+    The table is rebuilt when the topology is modified, including when a value is
+    changed with :py:meth:`MemAttr.set_value`. User should not use the constructor.
+
+    """
+
+    def __init__(
+        self,
+        topo: _TopoRef,
+        attrs: list[MemAttr],
+        initiators: list[_Bitmap | _Object],
+    ) -> None:
+        self._topo_ref = topo
+        self._attrs = attrs
+        self._initiators = initiators
+        self._rows = {_initiator_key(ini): i for i, ini in enumerate(initiators)}
+        # Name or ID -> attribute ID, resolved once so that lookups don't call hwloc.
+        self._ids: dict[str | int, int] = {}
+        for attr in attrs:
+            key = attr.native_handle.value
+            self._ids[key] = key
+            self._ids[attr.name] = key
+        self._build()
+
+    def _build(self) -> None:
+        topo = self._topo
+        self._generation = topo._generation
+        self._targets: list[_Object] = list(topo.iter_numa_nodes())
+        columns = {t.gp_index: j for j, t in enumerate(self._targets)}
+        n_rows, n_cols = len(self._initiators), len(self._targets)
+
+        # attribute ID -> values
+        self._values: dict[int, array] = {}
+        self._higher_first: dict[int, bool] = {}
+        for attr in self._attrs:
+            values = array("Q", [0]) * (n_rows * n_cols)
+            if attr.needs_initiator:
+                for i, initiator in enumerate(self._initiators):
+                    for target, value in attr.get_targets(initiator):
+                        j = columns.get(target.gp_index)
+                        if j is not None:
+                            values[i * n_cols + j] = value
+            else:
+                # Same value for all initiators.
+                for target, value in attr.get_targets(None):
+                    j = columns.get(target.gp_index)
+                    if j is not None:
+                        values[j::n_cols] = array("Q", [value]) * n_rows
+            key = attr.native_handle.value
+            self._values[key] = values
+            self._higher_first[key] = attr.higher_first
+        # (attribute ID, initiator key) -> best target
+        self._best: dict[tuple[int, tuple[str, int | str]], tuple[_Object, int]] = {}
+
+    def _check(self) -> None:
+        if self._topo._generation != self._generation:
+            self._build()
+
+    def _attr(self, attr: _AttrId) -> int:
+        key = self._ids.get(attr if isinstance(attr, str) else int(attr))
+        if key is None:
+            raise ValueError(f"The attribute {attr} is not in the table.")
+        return key
+
+    @property
+    def attrs(self) -> list[MemAttr]:
+        """Memory attributes in the table."""
+        return list(self._attrs)
+
+    @property
+    def initiators(self) -> list[_Bitmap | _Object]:
+        """Initiators, in the order of the rows."""
+        return list(self._initiators)
+
+    @property
+    def targets(self) -> list[_Object]:
+        """Target NUMA nodes, in the order of the columns."""
+        self._check()
+        return list(self._targets)
+
+    def values(self, attr: _AttrId) -> memoryview:
+        """Get a read-only 2-dimensional view of the values of an attribute. Rows are
+        initiators and columns are targets, the items are unsigned 64-bit integers. 0
+        means the value is unknown.
+
+        """
+        self._check()
+        return _matrix_view(
+            self._values[self._attr(attr)], len(self._initiators), len(self._targets)
+        )
+
+    def best_target(
+        self, initiator: _Initiator, attr: _AttrId = _core.MemAttrId.BANDWIDTH
+    ) -> tuple[_Object, int]:
+        """Get the best target NUMA node and its value for an initiator. Results are
+        cached. If the initiator is not a row of the table, the result is obtained from
+        :py:meth:`MemAttr.get_best_target`.
+
+        """
+        self._check()
+        key = self._attr(attr)
+        initiator = _sched_set(initiator)
+        ini_key = _initiator_key(initiator)
+        best = self._best.get((key, ini_key))
+        if best is not None:
+            return best
+
+        row = self._rows.get(ini_key)
+        if row is None:
+            best = MemAttrs(self._topo_ref).get(key).get_best_target(initiator)
+        else:
+            n_cols = len(self._targets)
+            values = self._values[key][row * n_cols : (row + 1) * n_cols]
+            known = [(v, j) for j, v in enumerate(values) if v != 0]
+            if not known:
+                raise ValueError(f"No value is known for the initiator: {initiator}")
+            if self._higher_first[key]:
+                value, j = max(known, key=lambda vj: (vj[0], -vj[1]))
+            else:
+                value, j = min(known)
+            best = (self._targets[j], value)
+        self._best[(key, ini_key)] = best
+        return best
+
+    def __repr__(self) -> str:
+        n_attrs, n_initiators = len(self._attrs), len(self._initiators)
+        return f"MemAttrTable(attrs={n_attrs}, initiators={n_initiators})"
+
+
 class MemAttrs(_TopoRefMixin):
     """Accessor for memory attributes."""
 
@@ -328,11 +471,44 @@ class MemAttrs(_TopoRefMixin):
 
         return MemAttr(_core.hwloc_memattr_id_t(attr_id), self._topo_ref)
 
+    def build_table(
+        self,
+        attrs: Sequence[_AttrId] = (
+            _core.MemAttrId.BANDWIDTH,
+            _core.MemAttrId.LATENCY,
+            _core.MemAttrId.CAPACITY,
+        ),
+        initiators: Sequence[_Initiator] | None = None,
+    ) -> MemAttrTable:
+        """Materialize the values of memory attributes for all initiator and target
+        pairs, see :py:class:`MemAttrTable`.
+
+        Parameters
+        ----------
+        attrs :
+            Memory attributes to include.
+        initiators :
+            Initiators of the rows. Defaults to the distinct cpusets of the NUMA nodes
+            that have CPUs, which is how the attributes are usually reported by the
+            operating system.
+        """
+        if initiators is None:
+            cpusets: dict[str, _Bitmap] = {}
+            for node in self._topo.iter_numa_nodes():
+                cpuset = node.cpuset
+                if cpuset is not None and not cpuset.is_zero():
+                    cpusets.setdefault(cpuset.to_string(), cpuset)
+            rows: list[_Bitmap | _Object] = list(cpusets.values())
+        else:
+            rows = [_sched_set(ini) for ini in initiators]
+        return MemAttrTable(self._topo_ref, [self.get(a) for a in attrs], rows)
+
     @_reuse_doc(_core.memattr_register)
     def register(self, name: str, flags: _Flags[MemAttrFlag] = 0) -> MemAttr:
         attr_id = _core.memattr_register(
             self._topo.native_handle, name, _or_flags(flags)
         )
+        self._topo._modified(objects=False)
         return MemAttr(attr_id, self._topo_ref)
 
     @_reuse_doc(_core.get_local_numanode_objs)
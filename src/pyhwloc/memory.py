@@ -0,0 +1,574 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+"""
+NUMA-Bound Memory
+=================
+
+Buffers allocated with a memory binding, see
+:py:meth:`~pyhwloc.topology.Topology.alloc_membind`. The buffers support the Python
+buffer protocol and the NumPy array interface, they can be consumed without copying:
+
+.. code-block:: python
+
+    import numpy as np
+
+    with Topology() as topo:
+        node = next(topo.iter_numa_nodes())
+        buf = topo.alloc_membind(1 << 20, node, MemBindPolicy.BIND)
+        array = np.asarray(buf)
+        array[:] = 1
+        del array
+        buf.release()
+
+"""
+
+from __future__ import annotations
+
+import ctypes
+import logging
+import mmap
+import threading
+import time
+import weakref
+from dataclasses import dataclass
+from typing import TYPE_CHECKING, Any, Callable, Sequence
+
+from .bitmap import Bitmap
+from .hwloc import core as _core
+from .hwobject import NumaNode, Object
+from .utils import (
+    _Flags,
+    _memview_to_mem,
+    _or_flags,
+    _TopoRefMixin,
+    memoryview_from_memory,
+)
+
+if TYPE_CHECKING:
+    from .topology import Topology, _BindTarget
+    from .utils import _TopoRef
+
+__all__ = [
+    "MemBindBuffer",
+    "MemBindPool",
+    "first_touch",
+    "MigrationStats",
+    "migrate_area",
+]
+
+
+def _to_nodeset(topo: Topology, target: _BindTarget, by_nodeset: bool) -> Bitmap:
+    if isinstance(target, Object):
+        nodeset = target.nodeset
+        if nodeset is None:
+            raise ValueError("Object has no associated NUMA nodes")
+        return nodeset
+    bitmap = Bitmap.from_sched_set(target) if isinstance(target, set) else target
+    if by_nodeset:
+        return bitmap
+    nodeset = Bitmap()
+    _core.cpuset_to_nodeset(
+        topo.native_handle, bitmap.native_handle, nodeset.native_handle
+    )
+    return nodeset
+
+
+# Above this size, the size classes are quarter steps between powers of two instead of
+# powers of two.
+_FINE_CLASSES = 2 << 20
+
+
+def _size_class(nbytes: int) -> int:
+    # Round up to whole pages, then to the size class. The padding is less than a
+    # quarter of the request above `_FINE_CLASSES`, and at most 1MB below.
+    page = mmap.PAGESIZE
+    size = (max(nbytes, 1) + page - 1) // page * page
+    if size <= _FINE_CLASSES:
+        return max(page, 1 << (size - 1).bit_length())
+    step = (1 << ((size - 1).bit_length() - 1)) // 4
+    return (size + step - 1) // step * step
+
+
+class MemBindBuffer(_TopoRefMixin):
+    """A writable buffer of memory bound to NUMA nodes. The memory is freed with
+    :py:func:`~pyhwloc.hwloc.core.free` (or returned to its :py:class:`MemBindPool`)
+    when :py:meth:`release` is called, when the buffer is garbage collected, or when
+    the topology is destroyed. User should not use the constructor.
+
+    Views and arrays created from the buffer must be deleted before it's released.
+
+    """
+
+    def __init__(
+        self,
+        addr: int,
+        nbytes: int,
+        capacity: int,
+        topo: _TopoRef,
+        pool: weakref.ReferenceType[MemBindPool] | None = None,
+        key: tuple[str, int] | None = None,
+    ) -> None:
+        self._addr: int | None = addr
+        self._nbytes = nbytes
+        self._capacity = capacity
+        self._topo_ref = topo
+        self._pool = pool
+        self._key = key
+        self._views: list[weakref.ReferenceType[memoryview]] = []
+        self._topo._allocations.add(self)
+
+    @property
+    def address(self) -> int:
+        """Address of the memory."""
+        if self._addr is None:
+            raise RuntimeError("This buffer has been released.")
+        return self._addr
+
+    @property
+    def nbytes(self) -> int:
+        """Size of the buffer in bytes."""
+        return self._nbytes
+
+    def __len__(self) -> int:
+        return self._nbytes
+
+    def as_memoryview(self) -> memoryview:
+        """Get a writable byte view of the buffer without copying."""
+        ptr = ctypes.c_void_p(self.address)
+        view = memoryview_from_memory(ptr, self._nbytes, False)
+        self._views = [ref for ref in self._views if ref() is not None]
+        self._views.append(weakref.ref(view))
+        return view
+
+    def __buffer__(self, flags: int) -> memoryview:
+        return self.as_memoryview()
+
+    def migrate(self, target: _BindTarget, **kwargs: Any) -> MigrationStats:
+        """Move the buffer to other NUMA nodes, see :py:func:`migrate_area` for the
+        parameters. A migrated buffer is freed on release instead of being returned to
+        its pool, as it no longer matches the binding of the cached blocks."""
+        stats = migrate_area(self._topo, self, target, **kwargs)
+        self._key = None
+        return stats
+
+    @property
+    def __array_interface__(self) -> dict[str, Any]:
+        # Share the data through a view so that the buffer can detect arrays that are
+        # still alive during release.
+        return {
+            "shape": (self._nbytes,),
+            "typestr": "|u1",
+            "data": self.as_memoryview(),
+            "version": 3,
+        }
+
+    def release(self) -> None:
+        """Free the memory. No-op if it's already released."""
+        if self._addr is None:
+            return
+        for ref in self._views:
+            view = ref()
+            if view is None:
+                continue
+            try:
+                view.release()
+            except BufferError as e:
+                raise RuntimeError(
+                    "The buffer is still being used by an exported view, delete arrays "
+                    "created from it first."
+                ) from e
+        self._views = []
+
+        addr, self._addr = self._addr, None
+        pool = self._pool() if self._pool is not None else None
+        if pool is not None and self._key is not None:
+            pool._recycle(addr, self._capacity, self._key)
+        else:
+            _core.free(self._topo.native_handle, ctypes.c_void_p(addr), self._capacity)
+
+    def __del__(self) -> None:
+        try:
+            self.release()
+        except Exception as e:
+            logging.warning(str(e))
+
+    def __copy__(self) -> MemBindBuffer:
+        raise RuntimeError("The MemBindBuffer class cannot be copied.")
+
+    def __deepcopy__(self, memo: dict) -> MemBindBuffer:
+        raise RuntimeError("The MemBindBuffer class cannot be copied.")
+
+    def __repr__(self) -> str:
+        return f"MemBindBuffer(nbytes={self._nbytes})"
+
+
+class MemBindPool(_TopoRefMixin):
+    """A pool of NUMA-bound memory. Released buffers are cached per nodeset and size
+    class, subsequent allocations reuse them instead of asking the OS for new memory.
+
+    Parameters
+    ----------
+    topology :
+        A loaded topology of this system. The pool is released along with the topology.
+    policy :
+        Memory binding policy for the allocations.
+    flags :
+        Memory binding flags for the allocations. Targets are treated as nodesets if
+        :py:attr:`~pyhwloc.topology.MemBindFlags.BYNODESET` is set, as cpusets
+        otherwise.
+    max_cached_bytes :
+        Maximum number of bytes kept in the cache, blocks exceeding the limit are freed.
+
+    """
+
+    def __init__(
+        self,
+        topology: Topology,
+        policy: _core.MemBindPolicy = _core.MemBindPolicy.BIND,
+        flags: _Flags[_core.MemBindFlags] = 0,
+        max_cached_bytes: int = 1 << 30,
+    ) -> None:
+        self._topo_ref = weakref.ref(topology)
+        self._policy = policy
+        flags = _or_flags(flags)
+        self._by_nodeset = bool(flags & _core.MemBindFlags.BYNODESET)
+        # Targets are converted to nodesets for keying the cache.
+        self._flags = flags | _core.MemBindFlags.BYNODESET
+        self._max_cached_bytes = max_cached_bytes
+        # (nodeset, size class) -> addresses
+        self._blocks: dict[tuple[str, int], list[int]] = {}
+        self._cached_bytes = 0
+        self._released = False
+        topology._allocations.add(self)
+
+    @property
+    def cached_bytes(self) -> int:
+        """Number of bytes held in the cache."""
+        return self._cached_bytes
+
+    def alloc(self, nbytes: int, target: _BindTarget) -> MemBindBuffer:
+        """Allocate a buffer bound to the NUMA nodes of `target`.
+
+        Parameters
+        ----------
+        nbytes :
+            Size of the buffer in bytes.
+        target :
+            NUMA nodes to bind the memory to. Same as the target of
+            :py:meth:`~pyhwloc.topology.Topology.set_membind`.
+        """
+        if nbytes <= 0:
+            raise ValueError("Size of the buffer must be positive.")
+        if self._released:
+            raise RuntimeError("The pool has been released.")
+        topo = self._topo
+        nodeset = _to_nodeset(topo, target, self._by_nodeset)
+        capacity = _size_class(nbytes)
+        key = (nodeset.to_string(), capacity)
+
+        blocks = self._blocks.get(key)
+        if blocks:
+            addr = blocks.pop()
+            self._cached_bytes -= capacity
+        else:
+            addr = _core.alloc_membind_policy(
+                topo.native_handle,
+                capacity,
+                nodeset.native_handle,
+                self._policy,
+                self._flags,
+            )
+        return MemBindBuffer(
+            addr, nbytes, capacity, self._topo_ref, weakref.ref(self), key
+        )
+
+    def _recycle(self, addr: int, capacity: int, key: tuple[str, int]) -> None:
+        if self._released or self._cached_bytes + capacity > self._max_cached_bytes:
+            _core.free(self._topo.native_handle, ctypes.c_void_p(addr), capacity)
+            return
+        self._blocks.setdefault(key, []).append(addr)
+        self._cached_bytes += capacity
+
+    def clear(self) -> None:
+        """Free all cached blocks."""
+        hdl = self._topo.native_handle if self._blocks else None
+        while self._blocks:
+            (_, capacity), blocks = self._blocks.popitem()
+            for addr in blocks:
+                _core.free(hdl, ctypes.c_void_p(addr), capacity)
+        self._cached_bytes = 0
+
+    def release(self) -> None:
+        """Free all cached blocks, and stop caching. Buffers that are still alive free
+        their memory directly when released."""
+        self.clear()
+        self._released = True
+
+    def __del__(self) -> None:
+        try:
+            self.release()
+        except Exception as e:
+            logging.warning(str(e))
+
+    def __repr__(self) -> str:
+        return f"MemBindPool(cached_bytes={self._cached_bytes})"
+
+
+def first_touch(
+    topology: Topology,
+    buf: MemBindBuffer,
+    nodes: Sequence[NumaNode] | None = None,
+    *,
+    verify: bool = False,
+) -> list[Bitmap]:
+    """Zero a buffer in parallel, with one thread bound to the CPUs of each NUMA node.
+
+    The buffer is split into contiguous page ranges, one for each node. With the
+    :py:attr:`~pyhwloc.topology.MemBindPolicy.FIRSTTOUCH` policy, the pages of each
+    range are allocated on the node that touches them first. With other policies, like
+    interleaving, the placement is decided by the policy and this function simply
+    speeds up the initialization.
+
+    Parameters
+    ----------
+    topology :
+        A loaded topology of this system.
+    buf :
+        The buffer to initialize.
+    nodes :
+        NUMA nodes to use. Defaults to all NUMA nodes that have CPUs.
+    verify :
+        Query the location of each range after touching it.
+
+    Returns
+    -------
+    The nodeset where each range is allocated if `verify` is True, an empty list
+    otherwise.
+    """
+    if nodes is None:
+        nodes = list(topology.iter_numa_nodes())
+    cpusets = [(n, n.cpuset) for n in nodes]
+    cpusets = [(n, c) for n, c in cpusets if c is not None and not c.is_zero()]
+    if not cpusets:
+        raise ValueError("No NUMA node with CPUs.")
+
+    page = mmap.PAGESIZE
+    n_pages = (buf.nbytes + page - 1) // page
+    n_ranges = min(len(cpusets), max(n_pages, 1))
+    addr = buf.address
+    bounds = [min(i * n_pages // n_ranges * page, buf.nbytes) for i in range(n_ranges)]
+    bounds.append(buf.nbytes)
+
+    errors: list[BaseException] = []
+    locations: list[Bitmap] = [Bitmap() for _ in range(n_ranges)]
+
+    def touch(i: int) -> None:
+        node, cpuset = cpusets[i]
+        try:
+            topology.set_thread_cpubind(threading.get_ident(), cpuset)
+        except Exception as e:
+            logging.warning(f"Failed to bind the thread to {node}: {e}")
+        begin, end = bounds[i], bounds[i + 1]
+        try:
+            # ctypes releases the GIL during the call.
+            ctypes.memset(addr + begin, 0, end - begin)
+            if verify and end > begin:
+                mem = memoryview_from_memory(
+                    ctypes.c_void_p(addr + begin), end - begin, False
+                )
+                locations[i] = topology.get_area_memlocation(
+                    mem, _core.MemBindFlags.BYNODESET
+                )
+                mem.release()
+        except BaseException as e:
+            errors.append(e)
+
+    threads = [threading.Thread(target=touch, args=(i,)) for i in range(n_ranges)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    if errors:
+        raise errors[0]
+    return locations if verify else []
+
+
+@dataclass(frozen=True)
+class MigrationStats:
+    """Progress of a :py:func:`migrate_area` call."""
+
+    nbytes: int
+    """Size of the area in bytes."""
+    n_chunks: int
+    """Number of chunks in the area."""
+    done_chunks: int
+    """Chunks that are migrated or skipped."""
+    migrated_bytes: int
+    """Bytes of the chunks that are migrated."""
+    skipped_bytes: int
+    """Bytes of the chunks that are already on the target nodes."""
+    elapsed: float
+    """Time since the start of the migration in seconds."""
+
+    @property
+    def throughput(self) -> float:
+        """Migrated bytes per second."""
+        return self.migrated_bytes / self.elapsed if self.elapsed > 0 else 0.0
+
+
+def migrate_area(
+    topology: Topology,
+    buf: MemBindBuffer | memoryview,
+    target: _BindTarget,
+    *,
+    chunk_bytes: int = 32 << 20,
+    parallel: bool = True,
+    only_remote: bool = False,
+    policy: _core.MemBindPolicy = _core.MemBindPolicy.BIND,
+    max_workers: int | None = None,
+    progress: Callable[[MigrationStats], None] | None = None,
+) -> MigrationStats:
+    """Move a buffer to other NUMA nodes, for example after the threads using it are
+    rescheduled to another package.
+
+    The area is split into page-aligned chunks, each chunk is bound to the target with
+    :py:meth:`~pyhwloc.topology.Topology.set_area_membind` and the
+    :py:attr:`~pyhwloc.topology.MemBindFlags.MIGRATE` flag. The chunks are migrated by
+    threads bound to the CPUs of the target nodes, the calls release the GIL and only
+    block the pages of one chunk at a time.
+
+    Parameters
+    ----------
+    topology :
+        A loaded topology of this system.
+    buf :
+        The area to migrate, like a :py:class:`MemBindBuffer`.
+    target :
+        The destination NUMA nodes. A :py:class:`~pyhwloc.bitmap.Bitmap` or a
+        :py:class:`set` is a nodeset.
+    chunk_bytes :
+        Size of a chunk, rounded up to a multiple of the page size.
+    parallel :
+        Migrate the chunks from multiple threads. Otherwise, the chunks are migrated by
+        the calling thread without changing its binding.
+    only_remote :
+        Query the location of each chunk with
+        :py:meth:`~pyhwloc.topology.Topology.get_area_memlocation` first, and skip the
+        chunks that are already on the target nodes or not allocated yet. The binding
+        of the skipped chunks is unchanged.
+    policy :
+        Memory binding policy of the migrated chunks.
+    max_workers :
+        Number of threads when `parallel` is True. Defaults to the number of cores of
+        the target nodes.
+    progress :
+        Called with the progress after each chunk. The calls are serialized, they may
+        come from the worker threads.
+
+    Returns
+    -------
+    The final statistics.
+    """
+    if chunk_bytes < 1:
+        raise ValueError("`chunk_bytes` must be positive.")
+    if max_workers is not None and max_workers < 1:
+        raise ValueError("`max_workers` must be positive.")
+    if isinstance(buf, MemBindBuffer):
+        addr, nbytes = buf.address, buf.nbytes
+    else:
+        ptr, nbytes = _memview_to_mem(buf)
+        assert ptr.value is not None or nbytes == 0
+        addr = ptr.value or 0
+
+    nodeset = _to_nodeset(topology, target, True)
+    if nodeset.is_zero():
+        raise ValueError("Empty target nodeset.")
+    flags = _core.MemBindFlags.MIGRATE | _core.MemBindFlags.BYNODESET
+
+    # Chunk boundaries are page-aligned, except for the ends of the area.
+    page = mmap.PAGESIZE
+    chunk_bytes = (chunk_bytes + page - 1) // page * page
+    base = addr - addr % page
+    bounds = list(range(base, addr + nbytes, chunk_bytes))[1:]
+    bounds = [addr] + bounds + [addr + nbytes] if nbytes else []
+    n_chunks = max(len(bounds) - 1, 0)
+
+    cpuset = Bitmap()
+    _core.cpuset_from_nodeset(
+        topology.native_handle, cpuset.native_handle, nodeset.native_handle
+    )
+    if max_workers is None:
+        max_workers = _core.get_nbobjs_inside_cpuset_by_type(
+            topology.native_handle, cpuset.native_handle, _core.ObjType.CORE
+        )
+    n_workers = max(min(max_workers, n_chunks), 1) if parallel else 0
+
+    lock = threading.Lock()
+    counters = {"next": 0, "done": 0, "migrated": 0, "skipped": 0}
+    errors: list[BaseException] = []
+    start = time.perf_counter()
+
+    def snapshot() -> MigrationStats:
+        return MigrationStats(
+            nbytes=nbytes,
+            n_chunks=n_chunks,
+            done_chunks=counters["done"],
+            migrated_bytes=counters["migrated"],
+            skipped_bytes=counters["skipped"],
+            elapsed=time.perf_counter() - start,
+        )
+
+    def migrate(i: int) -> None:
+        size = bounds[i + 1] - bounds[i]
+        mem = memoryview_from_memory(ctypes.c_void_p(bounds[i]), size, False)
+        skip = False
+        try:
+            if only_remote:
+                location = topology.get_area_memlocation(
+                    mem, _core.MemBindFlags.BYNODESET
+                )
+                skip = location.is_zero() or location.is_included(nodeset)
+            if not skip:
+                topology.set_area_membind(mem, nodeset, policy, flags)
+        finally:
+            mem.release()
+        with lock:
+            counters["done"] += 1
+            counters["skipped" if skip else "migrated"] += size
+            if progress is not None:
+                progress(snapshot())
+
+    def work() -> None:
+        if not cpuset.is_zero():
+            try:
+                topology.set_thread_cpubind(threading.get_ident(), cpuset)
+            except Exception as e:
+                logging.warning(f"Failed to bind the thread to {cpuset}: {e}")
+        while True:
+            with lock:
+                i = counters["next"]
+                counters["next"] += 1
+            if i >= n_chunks or errors:
+                return
+            try:
+                migrate(i)
+            except BaseException as e:
+                errors.append(e)
+                return
+
+    if n_workers == 0:
+        for i in range(n_chunks):
+            migrate(i)
+        return snapshot()
+
+    threads = [
+        threading.Thread(target=work, name=f"pyhwloc-migrate-{i}")
+        for i in range(n_workers)
+    ]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    if errors:
+        raise errors[0]
+    return snapshot()
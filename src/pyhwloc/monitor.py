@@ -0,0 +1,499 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+"""
+Placement Monitor
+=================
+
+Background sampling of where the watched processes, threads and buffers actually are,
+see :py:meth:`~pyhwloc.topology.Topology.placement_monitor`. Each sample records the
+last CPU location of the tasks and the NUMA nodes of a few pages of each buffer into a
+fixed-size ring buffer, the counters are aggregated per NUMA node.
+
+.. code-block::
+
+    with Topology.from_this_system(load=True) as topo:
+        buf = topo.alloc_membind(1 << 30, node, MemBindPolicy.BIND)
+        with topo.placement_monitor(interval=0.5) as monitor:
+            monitor.watch_thread(threading.current_thread())
+            monitor.watch_buffer(buf, node.nodeset)
+            run_job()
+            stats = monitor.stats()
+            print(stats.migrations, stats.violations, stats.remote_fraction)
+
+Bitmaps and page addresses are allocated once when a target is registered, a sample
+only updates them and writes integers into the ring buffer. The last CPU location is a
+hint from the OS and the pages are probed with
+:c:func:`hwloc_get_area_memlocation`, which isn't supported on all platforms.
+
+"""
+
+from __future__ import annotations
+
+import array
+import logging
+import mmap
+import threading
+import time
+import weakref
+from copy import copy
+from dataclasses import dataclass
+from types import TracebackType
+from typing import TYPE_CHECKING, Type
+
+from .bitmap import Bitmap
+from .hwloc import bitmap as _bitmap
+from .hwloc import core as _core
+from .utils import _matrix_view, _memview_to_mem, _TopoRefMixin
+
+if TYPE_CHECKING:
+    from .topology import Topology
+
+__all__ = ["NodeStats", "MonitorStats", "PlacementMonitor"]
+
+# Columns of a sample in the ring buffer, followed by 3 columns per NUMA node: the
+# tasks running on its CPUs, the probed pages located on it, and the remote ones.
+_TIME, _TASKS, _MIGRATIONS, _VIOLATIONS, _PAGES, _REMOTE = range(6)
+_N_FIXED = 6
+
+
+@dataclass(frozen=True)
+class NodeStats:
+    """Counters of a NUMA node summed over the samples."""
+
+    os_index: int
+    """OS index of the NUMA node."""
+    tasks: int
+    """Observations of tasks last running on a CPU of the node."""
+    pages: int
+    """Probed pages located on the node."""
+    remote_pages: int
+    """Probed pages located on the node while the buffer is expected elsewhere."""
+
+
+@dataclass(frozen=True)
+class MonitorStats:
+    """Counters summed over samples, see :py:meth:`PlacementMonitor.stats`."""
+
+    n_samples: int
+    """Number of samples in the window."""
+    duration: float
+    """Time between the first and the last sample in seconds."""
+    migrations: int
+    """Number of times a task was found on a different PU than in the previous
+    sample."""
+    violations: int
+    """Observations of tasks running outside of their expected cpuset."""
+    pages: int
+    """Probed pages that are allocated."""
+    remote_pages: int
+    """Probed pages located outside of the expected nodeset of their buffer."""
+    nodes: list[NodeStats]
+    """Counters of each NUMA node, in the logical order."""
+
+    @property
+    def remote_fraction(self) -> float:
+        """Fraction of the allocated pages that are remote, 0 if no page was found."""
+        return self.remote_pages / self.pages if self.pages else 0.0
+
+
+class _Task:
+    def __init__(
+        self, pid: int, thread: int | None, expected: Bitmap | None, flags: int
+    ) -> None:
+        self.pid = pid
+        # pthread handle of a thread, used for getting its binding.
+        self.thread = thread
+        self.expected = expected
+        self.flags = flags
+        self.proc_hdl = _core._open_proc_handle(pid)
+        self.thread_hdl = None if thread is None else _core._open_thread_handle(thread)
+        self.location = Bitmap()
+        self.binding = Bitmap()
+        self.last_pu = -1
+
+    def close(self) -> None:
+        _core._close_proc_handle(self.proc_hdl)
+        if self.thread_hdl is not None:
+            _core._close_thread_handle(self.thread_hdl)
+
+
+class _Buffer:
+    def __init__(self, mem: memoryview, expected: Bitmap, n_probes: int) -> None:
+        # Keep the buffer exported while it's watched.
+        self.mem = mem
+        addr, size = _memview_to_mem(mem)
+        assert addr.value is not None
+        page = mmap.PAGESIZE
+        first = addr.value - addr.value % page
+        n_pages = (addr.value + size - first + page - 1) // page
+        step = max(n_pages // n_probes, 1)
+        self.probes = [first + i * page for i in range(0, n_pages, step)][:n_probes]
+        self.expected = expected
+        self.location = Bitmap()
+
+
+class PlacementMonitor(_TopoRefMixin):
+    """Sampler of the placement of processes, threads and buffers. Use it as a context
+    manager, or call :py:meth:`start` and :py:meth:`stop`, to sample in a background
+    thread. :py:meth:`sample` can be called directly as well. All the methods are
+    thread-safe.
+
+    Parameters
+    ----------
+    topology :
+        A loaded topology of this system.
+    interval :
+        Time between two samples in seconds for the background thread.
+    capacity :
+        Number of samples kept in the ring buffer, the oldest samples are overwritten.
+
+    """
+
+    def __init__(
+        self, topology: Topology, *, interval: float = 1.0, capacity: int = 1024
+    ) -> None:
+        if interval <= 0 or capacity < 1:
+            raise ValueError("`interval` and `capacity` must be positive.")
+        self._topo_ref = weakref.ref(topology)
+        self._interval = interval
+        self._nodes = list(topology.iter_numa_nodes())
+        self._node_idx = _index_map([n.os_index for n in self._nodes])
+        self._pu_node = _pu_to_node(topology, self._nodes)
+
+        self._width = _N_FIXED + 3 * len(self._nodes)
+        self._capacity = capacity
+        self._ring = array.array("q", bytes(8 * self._width * capacity))
+        self._row = array.array("q", bytes(8 * self._width))
+        self._n_samples = 0
+
+        self._tasks: dict[int, _Task] = {}
+        self._buffers: dict[int, _Buffer] = {}
+        self._next_id = 0
+        self._lock = threading.Lock()
+        self._stop = threading.Event()
+        self._thread: threading.Thread | None = None
+
+    def _register(self, table: dict, item: _Task | _Buffer) -> int:
+        with self._lock:
+            key = self._next_id
+            self._next_id += 1
+            table[key] = item
+        return key
+
+    def watch_process(self, pid: int, expected: Bitmap | set[int] | None = None) -> int:
+        """Watch a process.
+
+        Parameters
+        ----------
+        pid :
+            Process ID.
+        expected :
+            The CPUs the process is expected to run on. Defaults to the binding of the
+            process at the time of the sample.
+
+        Returns
+        -------
+        A key for :py:meth:`unwatch`.
+        """
+        return self._register(self._tasks, _Task(pid, None, _cpuset(expected), 0))
+
+    def watch_thread(
+        self,
+        thread: threading.Thread | int,
+        expected: Bitmap | set[int] | None = None,
+    ) -> int:
+        """Watch a thread. Only supported on Linux.
+
+        Parameters
+        ----------
+        thread :
+            A started thread, or the native thread ID as returned by
+            :py:func:`threading.get_native_id`.
+        expected :
+            The CPUs the thread is expected to run on. Defaults to the binding of the
+            thread at the time of the sample.
+
+        Returns
+        -------
+        A key for :py:meth:`unwatch`.
+        """
+        flags = _core.CpuBindFlags.THREAD
+        if isinstance(thread, threading.Thread):
+            if thread.native_id is None:
+                raise ValueError("The thread is not started.")
+            task = _Task(thread.native_id, thread.ident, _cpuset(expected), flags)
+        else:
+            task = _Task(thread, None, _cpuset(expected), flags)
+        return self._register(self._tasks, task)
+
+    def watch_buffer(
+        self,
+        mem: memoryview | object,
+        expected: Bitmap | set[int] | None = None,
+        *,
+        n_probes: int = 64,
+    ) -> int:
+        """Watch the location of a buffer, like a
+        :py:class:`~pyhwloc.memory.MemBindBuffer`.
+
+        Parameters
+        ----------
+        mem :
+            A writable buffer. It's kept alive until :py:meth:`unwatch` is called.
+        expected :
+            Nodeset of the NUMA nodes the buffer is expected on. Defaults to the
+            binding of the buffer at the time of the registration.
+        n_probes :
+            Maximum number of pages probed in each sample, evenly spread over the
+            buffer.
+
+        Returns
+        -------
+        A key for :py:meth:`unwatch`.
+        """
+        if n_probes < 1:
+            raise ValueError("`n_probes` must be positive.")
+        view = mem if isinstance(mem, memoryview) else memoryview(mem)  # type: ignore
+        if expected is None:
+            nodeset, _ = self._topo.get_area_membind(
+                view, _core.MemBindFlags.BYNODESET
+            )
+        else:
+            nodeset = _cpuset(expected)
+        assert nodeset is not None
+        return self._register(self._buffers, _Buffer(view, nodeset, n_probes))
+
+    def unwatch(self, key: int) -> None:
+        """Stop watching a process, a thread or a buffer."""
+        with self._lock:
+            task = self._tasks.pop(key, None)
+            if task is not None:
+                task.close()
+            elif self._buffers.pop(key, None) is None:
+                raise KeyError(key)
+
+    def _sample_task(
+        self, hdl: _core.topology_t, task: _Task, row: array.array
+    ) -> None:
+        _core.get_proc_last_cpu_location(
+            hdl, task.proc_hdl, task.location.native_handle, task.flags
+        )
+        pu = _bitmap.bitmap_first(task.location.native_handle)
+        if pu < 0:
+            return
+        row[_TASKS] += 1
+        if task.last_pu >= 0 and pu != task.last_pu:
+            row[_MIGRATIONS] += 1
+        task.last_pu = pu
+
+        expected = task.expected
+        if expected is None:
+            expected = task.binding
+            if task.thread_hdl is not None:
+                _core.get_thread_cpubind(
+                    hdl, task.thread_hdl, expected.native_handle, 0
+                )
+            else:
+                _core.get_proc_cpubind(
+                    hdl, task.proc_hdl, expected.native_handle, task.flags
+                )
+        if not _bitmap.bitmap_isset(expected.native_handle, pu):
+            row[_VIOLATIONS] += 1
+        if pu < len(self._pu_node) and self._pu_node[pu] >= 0:
+            row[_N_FIXED + 3 * self._pu_node[pu]] += 1
+
+    def _sample_buffer(
+        self, hdl: _core.topology_t, buf: _Buffer, row: array.array
+    ) -> None:
+        location = buf.location.native_handle
+        expected = buf.expected.native_handle
+        flags = _core.MemBindFlags.BYNODESET
+        page = mmap.PAGESIZE
+        for addr in buf.probes:
+            _core.get_area_memlocation(hdl, addr, page, location, flags)
+            node = _bitmap.bitmap_first(location)
+            if node < 0 or node >= len(self._node_idx) or self._node_idx[node] < 0:
+                # Not allocated yet.
+                continue
+            col = _N_FIXED + 3 * self._node_idx[node]
+            row[_PAGES] += 1
+            row[col + 1] += 1
+            if not _bitmap.bitmap_isset(expected, node):
+                row[_REMOTE] += 1
+                row[col + 2] += 1
+
+    def sample(self) -> None:
+        """Take a sample of all the watched targets. Tasks that have exited are
+        skipped."""
+        hdl = self._topo.native_handle
+        with self._lock:
+            row = self._row
+            for i in range(self._width):
+                row[i] = 0
+            for task in self._tasks.values():
+                try:
+                    self._sample_task(hdl, task, row)
+                except (OSError, ValueError, RuntimeError):
+                    # The task has exited.
+                    continue
+            for buf in self._buffers.values():
+                self._sample_buffer(hdl, buf, row)
+            row[_TIME] = time.monotonic_ns()
+
+            start = (self._n_samples % self._capacity) * self._width
+            self._ring[start : start + self._width] = row
+            self._n_samples += 1
+
+    @property
+    def n_samples(self) -> int:
+        """Number of samples taken since the creation of the monitor."""
+        return self._n_samples
+
+    def samples(self) -> memoryview:
+        """Get a copy of the samples in the ring buffer, oldest first.
+
+        Returns
+        -------
+        A read-only, 2-dimensional view of int64 values with one row per sample. The
+        columns are the monotonic time in nanoseconds, the number of observed tasks,
+        the migrations, the violations, the probed pages, the remote pages, followed by
+        the tasks, the pages and the remote pages for each NUMA node.
+        """
+        with self._lock:
+            n = min(self._n_samples, self._capacity)
+            end = (self._n_samples % self._capacity) * self._width
+            if self._n_samples <= self._capacity:
+                items = self._ring[: n * self._width]
+            else:
+                items = self._ring[end:] + self._ring[:end]
+        return _matrix_view(items, n, self._width)
+
+    def stats(self, window: int | None = None) -> MonitorStats:
+        """Sum the counters of the latest samples.
+
+        Parameters
+        ----------
+        window :
+            Number of latest samples, defaults to all the samples in the ring buffer.
+        """
+        samples = self.samples()
+        n = samples.shape[0] if samples.ndim == 2 else 0
+        if window is not None:
+            if window < 1:
+                raise ValueError("`window` must be positive.")
+            n = min(n, window)
+        first = samples.shape[0] - n if samples.ndim == 2 else 0
+
+        totals = [0] * self._width
+        for i in range(first, first + n):
+            for j in range(1, self._width):
+                totals[j] += samples[i, j]
+        duration = (samples[first + n - 1, _TIME] - samples[first, _TIME]) if n else 0
+        return MonitorStats(
+            n_samples=n,
+            duration=duration / 1e9,
+            migrations=totals[_MIGRATIONS],
+            violations=totals[_VIOLATIONS],
+            pages=totals[_PAGES],
+            remote_pages=totals[_REMOTE],
+            nodes=[
+                NodeStats(
+                    os_index=node.os_index,
+                    tasks=totals[_N_FIXED + 3 * k],
+                    pages=totals[_N_FIXED + 3 * k + 1],
+                    remote_pages=totals[_N_FIXED + 3 * k + 2],
+                )
+                for k, node in enumerate(self._nodes)
+            ],
+        )
+
+    def _run(self) -> None:
+        while not self._stop.wait(self._interval):
+            try:
+                self.sample()
+            except Exception as e:
+                logging.warning(f"Placement monitor stopped: {e}")
+                return
+
+    def start(self) -> None:
+        """Start sampling in a background thread."""
+        if self._thread is not None:
+            raise RuntimeError("The monitor is already running.")
+        self._stop.clear()
+        self._thread = threading.Thread(
+            target=self._run, name="pyhwloc-monitor", daemon=True
+        )
+        self._thread.start()
+
+    def stop(self) -> None:
+        """Stop the background thread. No-op if it's not running."""
+        if self._thread is None:
+            return
+        self._stop.set()
+        self._thread.join()
+        self._thread = None
+
+    @property
+    def is_running(self) -> bool:
+        """Whether the background thread is running."""
+        return self._thread is not None and self._thread.is_alive()
+
+    def close(self) -> None:
+        """Stop the background thread and unwatch all the targets."""
+        self.stop()
+        with self._lock:
+            for task in self._tasks.values():
+                task.close()
+            self._tasks.clear()
+            self._buffers.clear()
+
+    def __enter__(self) -> PlacementMonitor:
+        self.start()
+        return self
+
+    def __exit__(
+        self,
+        exc_type: Type[BaseException] | None,
+        exc_val: BaseException | None,
+        exc_tb: TracebackType | None,
+    ) -> None:
+        self.close()
+
+    def __repr__(self) -> str:
+        return (
+            f"PlacementMonitor(n_tasks={len(self._tasks)}, "
+            f"n_buffers={len(self._buffers)}, n_samples={self._n_samples})"
+        )
+
+
+def _cpuset(target: Bitmap | set[int] | None) -> Bitmap | None:
+    if target is None:
+        return None
+    if isinstance(target, set):
+        return Bitmap.from_sched_set(target)
+    return copy(target)
+
+
+def _index_map(os_indices: list[int]) -> array.array:
+    # Position of each OS index, -1 for the missing ones.
+    result = array.array("i", [-1] * (max(os_indices, default=-1) + 1))
+    for i, os_index in enumerate(os_indices):
+        result[os_index] = i
+    return result
+
+
+def _pu_to_node(topology: Topology, nodes: list) -> array.array:
+    # Logical index of the smallest NUMA node covering each PU.
+    n_pus = topology.cpuset.last() + 1
+    result = array.array("i", [-1] * max(n_pus, 0))
+    weights = array.array("i", [0] * max(n_pus, 0))
+    for k, node in enumerate(nodes):
+        cpuset = node.cpuset
+        if cpuset is None:
+            continue
+        weight = cpuset.weight()
+        for pu in cpuset:
+            if 0 <= pu < n_pus and (result[pu] < 0 or weight < weights[pu]):
+                result[pu] = k
+                weights[pu] = weight
+    return result
@@ -18,7 +18,7 @@ from .bitmap import Bitmap
 from .hwloc import nvml as _nvml
 from .hwobject import OsDevice
 from .topology import Topology
-from .utils import _reuse_doc, _TopoRefMixin
+from .utils import DeviceLocality, _reuse_doc, _TopoRefMixin
 
 if TYPE_CHECKING:
     from .utils import _TopoRef
@@ -26,6 +26,7 @@ if TYPE_CHECKING:
 __all__ = [
     "Device",
     "get_device",
+    "get_all_devices",
     "get_cpu_affinity",
 ]
 
@@ -138,6 +139,25 @@ def get_device(topology: Topology, device: int | ctypes._Pointer) -> Device:
         )
 
 
+def get_all_devices(topology: Topology) -> list[DeviceLocality]:
+    """Get the locality of all NVML devices in one native call. NVML must be
+    initialized. The result is cached by the topology until it's modified.
+
+    Parameters
+    ----------
+    topology :
+        Hwloc topology, loaded with OS devices.
+
+    """
+
+    def count() -> int:
+        import pynvml as nm
+
+        return nm.nvmlDeviceGetCount()
+
+    return topology._get_all_devices("nvml", count, _nvml.get_devices)
+
+
 _MASK_SIZE = 64
 
 
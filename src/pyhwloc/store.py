@@ -0,0 +1,346 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+"""
+Topology Store
+==============
+
+A collection of node topologies deduplicated by hardware shape, for inventories of
+many machines with a few distinct models. Nodes of the same shape share a single loaded
+topology, the store only keeps the per-node differences: the allowed CPU and NUMA node
+sets, and the info attributes of the topology.
+
+.. code-block::
+
+    with TopologyStore() as store:
+        store.add_xml_dir("/path/to/exports", io_types_filter=TypeFilter.KEEP_IMPORTANT)
+        for shape, names in store.shapes().items():
+            # Queries on the shared topology are done once per shape.
+            n_cores = store.topology(names[0]).n_cores()
+        tenant = store.view("node-0042")
+
+The shape of a topology is computed by :py:func:`shape_key` from the synthetic
+description of the topology, or from the objects for topologies without a synthetic
+description, plus the attributes of the I/O objects. Distances, memory attributes and
+CPU kinds are not part of the shape, nodes of the same shape are assumed to share them.
+
+To keep disallowed resources in the shape and record them as per-node overrides, load
+the topologies with :py:attr:`~pyhwloc.topology.TopologyFlags.INCLUDE_DISALLOWED`.
+Otherwise, disallowed PUs and NUMA nodes are removed by hwloc, and a node with a
+restricted allowed set has a shape of its own.
+
+"""
+
+from __future__ import annotations
+
+import hashlib
+import os
+import threading
+from collections.abc import Iterator, Mapping
+from copy import copy
+from dataclasses import dataclass
+from types import TracebackType
+from typing import TYPE_CHECKING, Type
+
+from .bitmap import Bitmap
+from .hwobject import Cache, NumaNode, Object
+from .topology import Topology, TopologyFlags, TypeFilter, _list_xml_dir
+from .utils import _Flags
+
+if TYPE_CHECKING:
+    from .view import TopologyView
+
+__all__ = ["TopologyStore", "shape_key"]
+
+
+def _object_signature(obj: Object) -> str:
+    fields = [obj.type.name, str(obj.depth), str(obj.os_index)]
+    fields += [obj.subtype or "", obj.name or ""]
+    if obj.is_io():
+        fields.append(obj.format_attr(flags=0) or "")
+        return " ".join(fields)
+    fields += [str(obj.complete_cpuset), str(obj.complete_nodeset)]
+    if isinstance(obj, Cache):
+        fields += [str(obj.size), str(obj.linesize), str(obj.associativity)]
+    elif isinstance(obj, NumaNode):
+        fields.append(str(obj.local_memory))
+    return " ".join(fields)
+
+
+def shape_key(topology: Topology) -> str:
+    """Compute the hardware shape of a loaded topology. Topologies of identical
+    machines have the same key, regardless of the host names and of the allowed sets.
+
+    Returns
+    -------
+    A hexadecimal digest.
+    """
+    digest = hashlib.sha256()
+    try:
+        digest.update(topology.export_synthetic(0).encode("utf-8"))
+    except (ValueError, RuntimeError):
+        # Irregular topologies, like asymmetric packages, can't be exported.
+        for obj in topology.iter_all_breadth_first():
+            if not obj.is_io():
+                digest.update(_object_signature(obj).encode("utf-8") + b"\n")
+    for obj in topology.iter_all_breadth_first():
+        if obj.is_io():
+            digest.update(b"\n" + _object_signature(obj).encode("utf-8"))
+    return digest.hexdigest()
+
+
+class _Shape:
+    def __init__(self, topology: Topology) -> None:
+        self.topology = topology
+        self.allowed_cpuset = topology.allowed_cpuset
+        self.allowed_nodeset = topology.allowed_nodeset
+        self.info = topology.info
+        self.names: dict[str, None] = {}
+
+
+@dataclass(frozen=True)
+class _Node:
+    shape: str
+    # None when equal to the shared topology.
+    allowed_cpuset: Bitmap | None
+    allowed_nodeset: Bitmap | None
+    # Info attributes that differ from the shared topology, and the missing ones.
+    info: dict[str, str]
+    missing_info: tuple[str, ...]
+
+
+class TopologyStore:
+    """Topologies of many nodes keyed by node name. Topologies added to the store are
+    left untouched, the store keeps a copy of the first topology of each shape. Use the
+    store as a context manager or call :py:meth:`close` to destroy the shared
+    topologies. All the methods are thread-safe.
+
+    The shared topologies must not be modified. Their allowed sets and info attributes
+    are the ones of the first node of the shape, use :py:meth:`allowed_cpuset`,
+    :py:meth:`info` or :py:meth:`view` to get the ones of a specific node.
+
+    """
+
+    def __init__(self) -> None:
+        self._shapes: dict[str, _Shape] = {}
+        self._nodes: dict[str, _Node] = {}
+        self._lock = threading.Lock()
+
+    def _add(self, name: str, topology: Topology, owned: bool) -> tuple[str, bool]:
+        # Returns the shape and whether the topology is kept as the shared topology.
+        if not topology.is_loaded:
+            raise ValueError("The topology must be loaded.")
+        key = shape_key(topology)
+        cpuset = topology.allowed_cpuset
+        nodeset = topology.allowed_nodeset
+        info = topology.info
+        with self._lock:
+            self._discard(name)
+            shape = self._shapes.get(key)
+            kept = False
+            if shape is None:
+                shape = _Shape(topology if owned else copy(topology))
+                self._shapes[key] = shape
+                kept = owned
+            self._nodes[name] = _Node(
+                shape=key,
+                allowed_cpuset=None if cpuset == shape.allowed_cpuset else cpuset,
+                allowed_nodeset=None if nodeset == shape.allowed_nodeset else nodeset,
+                info={k: v for k, v in info.items() if shape.info.get(k) != v},
+                missing_info=tuple(k for k in shape.info if k not in info),
+            )
+            shape.names[name] = None
+        return key, kept
+
+    def add(self, name: str, topology: Topology) -> str:
+        """Add or replace a node.
+
+        Parameters
+        ----------
+        name :
+            Name of the node, like the host name.
+        topology :
+            A loaded topology of the node. It's copied if it's the first one of its
+            shape, and can be destroyed afterward.
+
+        Returns
+        -------
+        The shape of the node, see :py:func:`shape_key`.
+        """
+        return self._add(name, topology, owned=False)[0]
+
+    def add_xml_files(
+        self,
+        xml_paths: Mapping[str, os.PathLike | str],
+        *,
+        io_types_filter: TypeFilter | None = None,
+        flags: _Flags[TopologyFlags] = 0,
+        max_workers: int | None = None,
+        batch_size: int = 64,
+    ) -> None:
+        """Add nodes from XML exports, see
+        :py:meth:`~pyhwloc.topology.Topology.from_xml_files`. The files are loaded in
+        parallel by batches, at most `batch_size` topologies are loaded at the same
+        time besides the shared ones.
+
+        Parameters
+        ----------
+        xml_paths :
+            Paths of the XML files keyed by node name.
+        io_types_filter :
+            Filter for IO objects, see
+            :py:meth:`~pyhwloc.topology.Topology.set_io_types_filter`.
+        flags :
+            Topology flags, like
+            :py:attr:`~pyhwloc.topology.TopologyFlags.INCLUDE_DISALLOWED`.
+        max_workers :
+            Number of threads used for loading the files.
+        batch_size :
+            Number of files loaded in a batch.
+        """
+        if batch_size < 1:
+            raise ValueError("`batch_size` must be positive.")
+        items = list(xml_paths.items())
+        for i in range(0, len(items), batch_size):
+            batch = items[i : i + batch_size]
+            topos = Topology.from_xml_files(
+                [path for _, path in batch],
+                io_types_filter=io_types_filter,
+                flags=flags,
+                max_workers=max_workers,
+            )
+            kept: set[int] = set()
+            try:
+                for j, ((name, _), topo) in enumerate(zip(batch, topos)):
+                    if self._add(name, topo, owned=True)[1]:
+                        kept.add(j)
+            finally:
+                for j, topo in enumerate(topos):
+                    if j not in kept:
+                        topo.destroy()
+
+    def add_xml_dir(
+        self,
+        dirname: os.PathLike | str,
+        pattern: str = "*.xml",
+        *,
+        io_types_filter: TypeFilter | None = None,
+        flags: _Flags[TopologyFlags] = 0,
+        max_workers: int | None = None,
+        batch_size: int = 64,
+    ) -> None:
+        """Add nodes from the XML files of a directory, named after the files without
+        the extension. See :py:meth:`add_xml_files` for the parameters."""
+        dirname = os.fspath(os.path.expanduser(dirname))
+        paths = {
+            os.path.splitext(name)[0]: os.path.join(dirname, name)
+            for name in _list_xml_dir(dirname, pattern)
+        }
+        self.add_xml_files(
+            paths,
+            io_types_filter=io_types_filter,
+            flags=flags,
+            max_workers=max_workers,
+            batch_size=batch_size,
+        )
+
+    def _discard(self, name: str) -> None:
+        node = self._nodes.pop(name, None)
+        if node is None:
+            return
+        shape = self._shapes[node.shape]
+        del shape.names[name]
+        if not shape.names:
+            del self._shapes[node.shape]
+            shape.topology.destroy()
+
+    def remove(self, name: str) -> None:
+        """Remove a node. The shared topology is destroyed with the last node of its
+        shape."""
+        with self._lock:
+            if name not in self._nodes:
+                raise KeyError(name)
+            self._discard(name)
+
+    def _node(self, name: str) -> tuple[_Node, _Shape]:
+        with self._lock:
+            node = self._nodes[name]
+            return node, self._shapes[node.shape]
+
+    def __len__(self) -> int:
+        return len(self._nodes)
+
+    def __contains__(self, name: object) -> bool:
+        return name in self._nodes
+
+    def __iter__(self) -> Iterator[str]:
+        """Iterate over the node names in insertion order."""
+        with self._lock:
+            names = list(self._nodes)
+        return iter(names)
+
+    @property
+    def n_shapes(self) -> int:
+        """Number of distinct shapes, which is the number of shared topologies."""
+        return len(self._shapes)
+
+    def shapes(self) -> dict[str, list[str]]:
+        """Get the node names of each shape."""
+        with self._lock:
+            return {key: list(shape.names) for key, shape in self._shapes.items()}
+
+    def shape_of(self, name: str) -> str:
+        """Get the shape of a node, see :py:func:`shape_key`."""
+        return self._node(name)[0].shape
+
+    def topology(self, name: str) -> Topology:
+        """Get the topology shared by the nodes of the same shape. It's owned by the
+        store and must not be modified."""
+        return self._node(name)[1].topology
+
+    def allowed_cpuset(self, name: str) -> Bitmap:
+        """Get the allowed CPUs of a node."""
+        node, shape = self._node(name)
+        cpuset = node.allowed_cpuset
+        return copy(shape.allowed_cpuset if cpuset is None else cpuset)
+
+    def allowed_nodeset(self, name: str) -> Bitmap:
+        """Get the allowed NUMA nodes of a node."""
+        node, shape = self._node(name)
+        nodeset = node.allowed_nodeset
+        return copy(shape.allowed_nodeset if nodeset is None else nodeset)
+
+    def info(self, name: str) -> dict[str, str]:
+        """Get the info attributes of the topology of a node, see
+        :py:attr:`~pyhwloc.topology.Topology.info`."""
+        node, shape = self._node(name)
+        info = {k: v for k, v in shape.info.items() if k not in node.missing_info}
+        info.update(node.info)
+        return info
+
+    def view(self, name: str) -> TopologyView:
+        """Get a view of the shared topology restricted to the allowed CPUs of a node,
+        see :py:meth:`~pyhwloc.topology.Topology.view`."""
+        return self.topology(name).view(self.allowed_cpuset(name))
+
+    def close(self) -> None:
+        """Remove all the nodes and destroy the shared topologies."""
+        with self._lock:
+            for shape in self._shapes.values():
+                shape.topology.destroy()
+            self._shapes.clear()
+            self._nodes.clear()
+
+    def __enter__(self) -> TopologyStore:
+        return self
+
+    def __exit__(
+        self,
+        exc_type: Type[BaseException] | None,
+        exc_val: BaseException | None,
+        exc_tb: TracebackType | None,
+    ) -> None:
+        self.close()
+
+    def __repr__(self) -> str:
+        return f"TopologyStore(n_nodes={len(self)}, n_shapes={self.n_shapes})"
+
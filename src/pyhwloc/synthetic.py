@@ -0,0 +1,213 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+"""
+Synthetic Topologies
+====================
+
+Generate synthetic descriptions of large or unusual machines, for testing and for
+benchmarking the scaling of code working on topologies, see
+:py:meth:`~pyhwloc.topology.Topology.from_synthetic` for the synthetic backend of
+hwloc.
+
+.. code-block::
+
+    shape = SyntheticShape(packages=8, numa_per_package=2, cores=16)
+    with shape.load() as topo:
+        assert topo.n_cpus() == shape.n_pus
+
+    # Twice the packages of a preset.
+    with PRESETS["cxl"].scaled(2).load() as topo:
+        ...
+
+Memory-only NUMA nodes, like the CXL memory expanders, are attached to the packages
+besides the regular NUMA nodes, as reported by hwloc on these machines. The synthetic
+backend doesn't provide distances, :py:meth:`SyntheticShape.load` adds a NUMA latency
+matrix based on the hops between the NUMA nodes in the tree.
+
+"""
+
+from __future__ import annotations
+
+import math
+from dataclasses import dataclass, fields, replace
+
+from .hwloc import core as _core
+from .hwobject import Object
+from .topology import DistancesKind, Topology
+
+__all__ = ["SyntheticShape", "PRESETS", "add_numa_distances"]
+
+_GiB = 1 << 30
+_MiB = 1 << 20
+_KiB = 1 << 10
+
+
+@dataclass(frozen=True)
+class SyntheticShape:
+    """Shape of a synthetic machine. The counts are the number of children for each
+    parent, the total numbers are available as properties like :py:attr:`n_pus`."""
+
+    packages: int = 1
+    """Packages in the innermost group, or in the machine if there's no group."""
+    cores: int = 4
+    """Cores in each L3 cache."""
+    pus: int = 2
+    """Hardware threads in each core."""
+    numa_per_package: int = 1
+    """Regular NUMA nodes in each package. More than one adds a Group level for each
+    node, like the sub-NUMA clustering."""
+    l3_per_numa: int = 1
+    """L3 caches in each regular NUMA node."""
+    groups: tuple[int, ...] = ()
+    """Arity of the Group levels above the packages, outermost first."""
+    cxl_per_package: int = 0
+    """Memory-only NUMA nodes in each package."""
+    memory: int = 16 * _GiB
+    """Size of a regular NUMA node in bytes."""
+    cxl_memory: int = 64 * _GiB
+    """Size of a memory-only NUMA node in bytes."""
+    caches: bool = True
+    """Whether cache levels are generated, the L2 and L1d are private to a core."""
+    l3_size: int = 32 * _MiB
+    """Size of an L3 cache in bytes."""
+    l2_size: int = 1 * _MiB
+    """Size of an L2 cache in bytes."""
+    l1_size: int = 32 * _KiB
+    """Size of an L1d cache in bytes."""
+
+    def __post_init__(self) -> None:
+        for f in fields(self):
+            value = getattr(self, f.name)
+            if f.name == "groups":
+                if any(g < 1 for g in value):
+                    raise ValueError("Group arities must be positive.")
+            elif f.name == "cxl_per_package":
+                if value < 0:
+                    raise ValueError("`cxl_per_package` must be non-negative.")
+            elif isinstance(value, int) and not isinstance(value, bool) and value < 1:
+                raise ValueError(f"`{f.name}` must be positive.")
+
+    @property
+    def n_packages(self) -> int:
+        """Number of packages in the machine."""
+        return math.prod(self.groups) * self.packages
+
+    @property
+    def n_numa_nodes(self) -> int:
+        """Number of NUMA nodes in the machine, including the memory-only ones."""
+        return self.n_packages * (self.numa_per_package + self.cxl_per_package)
+
+    @property
+    def n_cores(self) -> int:
+        """Number of cores in the machine."""
+        return (
+            self.n_packages * self.numa_per_package * self.l3_per_numa * self.cores
+        )
+
+    @property
+    def n_pus(self) -> int:
+        """Number of PUs in the machine."""
+        return self.n_cores * self.pus
+
+    def description(self) -> str:
+        """Get the synthetic description accepted by
+        :py:meth:`~pyhwloc.topology.Topology.from_synthetic`."""
+        levels = [f"group:{g}" for g in self.groups]
+        levels.append(f"pack:{self.packages}")
+        numa = f"[numa(memory={self.memory})]"
+        cxl = [f"[numa(memory={self.cxl_memory})]"] * self.cxl_per_package
+        if self.numa_per_package == 1:
+            levels += [numa, *cxl]
+        else:
+            levels += [*cxl, f"group:{self.numa_per_package}", numa]
+        if self.caches:
+            levels += [
+                f"l3:{self.l3_per_numa}(size={self.l3_size})",
+                f"l2:{self.cores}(size={self.l2_size})",
+                f"l1d:1(size={self.l1_size})",
+                "core:1",
+            ]
+        else:
+            levels += [f"group:{self.l3_per_numa}"] if self.l3_per_numa > 1 else []
+            levels.append(f"core:{self.cores}")
+        levels.append(f"pu:{self.pus}")
+        return " ".join(levels)
+
+    def scaled(self, factor: int) -> SyntheticShape:
+        """Get the same shape with `factor` times more packages."""
+        if factor < 1:
+            raise ValueError("`factor` must be positive.")
+        return replace(self, packages=self.packages * factor)
+
+    def load(self, *, distances: bool = True) -> Topology:
+        """Create a loaded topology of this shape.
+
+        Parameters
+        ----------
+        distances :
+            Add a NUMA latency matrix with :py:func:`add_numa_distances` if the machine
+            has more than one NUMA node.
+        """
+        topo = Topology.from_synthetic(self.description(), load=True)
+        try:
+            if distances and self.n_numa_nodes > 1:
+                add_numa_distances(topo)
+        except Exception:
+            topo.destroy()
+            raise
+        return topo
+
+
+def _path(obj: Object) -> list[int]:
+    # GP indices from the root to the object.
+    path = []
+    node: Object | None = obj
+    while node is not None:
+        path.append(node.gp_index)
+        node = node.parent
+    return path[::-1]
+
+
+def add_numa_distances(topology: Topology, name: str = "NUMALatency") -> None:
+    """Add a latency matrix between all the NUMA nodes of a topology. The latency is 10
+    for a node to itself, plus 5 for each hop between two nodes in the tree.
+
+    Parameters
+    ----------
+    topology :
+        A loaded topology, the matrix is added with
+        :c:func:`hwloc_distances_add_create`.
+    name :
+        Name of the matrix.
+    """
+    nodes = list(topology.iter_numa_nodes())
+    n = len(nodes)
+    paths = [_path(node) for node in nodes]
+    values = (_core.hwloc_uint64_t * (n * n))()
+    for i in range(n):
+        for j in range(n):
+            common = 0
+            for a, b in zip(paths[i], paths[j]):
+                if a != b:
+                    break
+                common += 1
+            hops = len(paths[i]) + len(paths[j]) - 2 * common
+            values[i * n + j] = 10 if i == j else 10 + 5 * hops
+
+    objs = (_core.obj_t * n)(*[node.native_handle for node in nodes])
+    hdl = topology.native_handle
+    kind = DistancesKind.VALUE_LATENCY | DistancesKind.FROM_USER
+    handle = _core.distances_add_create(hdl, name, kind)
+    _core.distances_add_values(hdl, handle, n, objs, values)
+    _core.distances_add_commit(hdl, handle, 0)
+    topology._modified(objects=False)
+
+
+PRESETS: dict[str, SyntheticShape] = {
+    "8-socket": SyntheticShape(packages=8, numa_per_package=2, cores=16),
+    "4096-pu": SyntheticShape(packages=8, numa_per_package=4, l3_per_numa=2, cores=32),
+    "deep-groups": SyntheticShape(groups=(2, 2, 2, 2), packages=2, cores=4),
+    "many-numa": SyntheticShape(packages=2, numa_per_package=16, cores=4, pus=1),
+    "cxl": SyntheticShape(packages=2, numa_per_package=2, cxl_per_package=2, cores=8),
+}
+"""Named shapes of unusual machines."""
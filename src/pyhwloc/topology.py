@@ -8,18 +8,29 @@ The Topology Interface
 
 from __future__ import annotations
 
+import array
+import asyncio
 import ctypes
+import fnmatch
+import hashlib
 import logging
 import os
+import platform
+import tempfile
+import threading
 import weakref
+import zlib
 from collections import namedtuple
+from concurrent.futures import Future, ThreadPoolExecutor
 from copy import copy
+from dataclasses import dataclass, replace
 from types import TracebackType
 from typing import (
     TYPE_CHECKING,
     Any,
     Callable,
     Iterator,
+    Sequence,
     Type,
     TypeAlias,
     cast,
@@ -33,11 +44,35 @@ from .hwloc import lib as _lib
 from .hwobject import Object as _Object
 from .hwobject import ObjType as _ObjType
 from .hwobject import _object
-from .utils import _Flags, _get_info, _memview_to_mem, _or_flags, _reuse_doc
+from .utils import (
+    DeviceLocality,
+    PciId,
+    _array_ptr,
+    _Flags,
+    _get_info,
+    _memview_to_mem,
+    _or_flags,
+    _reuse_doc,
+    _TopoRefMixin,
+)
 
 if TYPE_CHECKING or _lib._IS_DOC_BUILD:
     from . import distances as _distances
+    from .allocator import CoreAllocator as _CoreAllocator
+    from .caches import CacheProfile as _CacheProfile
+    from .diff import TopologyDiff as _TopologyDiff
+    from .locality import IoAffinityMatrix as _IoAffinityMatrix
+    from .locality import LocalityIndex as _LocalityIndex
     from .memattrs import MemAttrs as _MemAttrs
+    from .memory import MemBindBuffer as _MemBindBuffer
+    from .memory import MemBindPool as _MemBindPool
+    from .monitor import PlacementMonitor as _PlacementMonitor
+    from .view import TopologyView as _TopologyView
+
+if TYPE_CHECKING:
+    from collections.abc import Buffer
+
+    from .utils import _TopoRef
 
 __all__ = [
     "Topology",
@@ -50,6 +85,8 @@ __all__ = [
     "CpuBindFlags",
     "AllowFlags",
     "RestrictFlags",
+    "LevelSnapshot",
+    "PlacementPlan",
 ]
 
 
@@ -67,10 +104,211 @@ def _from_impl(fn: Callable[[_core.topology_t], None], load: bool) -> _core.topo
     return hdl
 
 
-def _from_xml_buffer(xml_buffer: str, load: bool) -> _core.topology_t:
+def _from_xml_buffer(xml_buffer: str | Buffer, load: bool) -> _core.topology_t:
     return _from_impl(lambda hdl: _core.topology_set_xmlbuffer(hdl, xml_buffer), load)
 
 
+def _from_xml_files(
+    paths: list[str],
+    io_types_filter: TypeFilter | None,
+    flags: int,
+    max_workers: int | None,
+) -> list[_core.topology_t]:
+    def load(path: str) -> _core.topology_t:
+        def setup(hdl: _core.topology_t) -> None:
+            _core.topology_set_xml(hdl, path)
+            if flags:
+                _core.topology_set_flags(hdl, flags)
+            if io_types_filter is not None:
+                _core.topology_set_io_types_filter(hdl, io_types_filter)
+
+        # The GIL is released while hwloc parses the file.
+        return _from_impl(setup, True)
+
+    if not paths:
+        return []
+    with ThreadPoolExecutor(
+        max_workers=max_workers, thread_name_prefix="pyhwloc-xml"
+    ) as executor:
+        futures = [executor.submit(load, path) for path in paths]
+    handles: list[_core.topology_t] = []
+    error: BaseException | None = None
+    for future in futures:
+        exc = future.exception()
+        if exc is None:
+            handles.append(future.result())
+        elif error is None:
+            error = exc
+    if error is not None:
+        for hdl in handles:
+            _core.topology_destroy(hdl)
+        raise error
+    return handles
+
+
+def _list_xml_dir(dirname: str, pattern: str) -> list[str]:
+    return sorted(
+        entry.name
+        for entry in os.scandir(dirname)
+        if entry.is_file() and fnmatch.fnmatch(entry.name, pattern)
+    )
+
+
+# The cache file starts with a header line: magic and crc32 of the XML. The XML document
+# follows.
+_CACHE_MAGIC = "pyhwloc-topology-cache-v2"
+
+
+def _read_text(path: str) -> str:
+    try:
+        with open(path, "r") as fd:
+            return fd.read().strip()
+    except OSError:
+        return ""
+
+
+def _default_cache_dir() -> str:
+    if "PYHWLOC_CACHE_DIR" in os.environ:
+        return os.environ["PYHWLOC_CACHE_DIR"]
+    base = os.environ.get("XDG_CACHE_HOME", os.path.join("~", ".cache"))
+    return os.path.join(os.path.expanduser(base), "pyhwloc")
+
+
+def _system_cache_key(io_types_filter: _core.TypeFilter | None) -> str:
+    # Identifies a boot of this machine. The online CPU list is included so that
+    # hotplugging CPUs invalidates the cache. The boot ID and the online list are only
+    # available on Linux, other platforms rely on the checks in `_from_cache`.
+    parts = [
+        platform.node(),
+        _read_text("/proc/sys/kernel/random/boot_id"),
+        _read_text("/sys/devices/system/cpu/online") or str(os.cpu_count()),
+        str(_core.get_api_version()),
+        "" if io_types_filter is None else str(int(io_types_filter)),
+    ]
+    return hashlib.sha256("\0".join(parts).encode("utf-8")).hexdigest()
+
+
+def _matches_live_system(hdl: _core.topology_t) -> bool:
+    # Cheap checks against the running machine, for changes that are not covered by
+    # the cache key: the CPUs this process may run on and, on Linux, the online NUMA
+    # nodes must be present in the cached topology.
+    cpuset = _Bitmap.from_native_handle(
+        _core.topology_get_complete_cpuset(hdl), own=False
+    )
+    nodeset = _Bitmap.from_native_handle(
+        _core.topology_get_complete_nodeset(hdl), own=False
+    )
+    if hasattr(os, "sched_getaffinity"):
+        live = _Bitmap.from_sched_set(os.sched_getaffinity(0))
+        if not live.is_included(cpuset):
+            return False
+    nodes = _read_text("/sys/devices/system/node/online")
+    if nodes:
+        try:
+            live = _Bitmap.from_list_string(nodes)
+        except (ValueError, RuntimeError):
+            return False
+        if not live.is_included(nodeset):
+            return False
+    return True
+
+
+def _from_cached_xml(xml_buffer: str) -> _core.topology_t:
+    # Let hwloc treat the XML as this system and apply the current process
+    # restrictions (e.g. cgroup) to the cached topology.
+    flags = (
+        _core.TopologyFlags.IS_THISSYSTEM
+        | _core.TopologyFlags.THISSYSTEM_ALLOWED_RESOURCES
+        | _core.TopologyFlags.IMPORT_SUPPORT
+    )
+
+    def _(hdl: _core.topology_t) -> None:
+        _core.topology_set_flags(hdl, flags)
+        _core.topology_set_xmlbuffer(hdl, xml_buffer)
+
+    return _from_impl(_, True)
+
+
+def _from_cache(path: str) -> _core.topology_t | None:
+    """Load a topology from the cache file, returns None if the cache is missing or
+    invalid."""
+    try:
+        with open(path, "r") as fd:
+            header = fd.readline().split()
+            xml_buffer = fd.read()
+    except (OSError, UnicodeDecodeError):
+        return None
+    if len(header) != 2 or header[0] != _CACHE_MAGIC:
+        return None
+    if header[1] != str(zlib.crc32(xml_buffer.encode("utf-8"))):
+        return None
+
+    try:
+        hdl = _from_cached_xml(xml_buffer)
+    except (RuntimeError, OSError, ValueError) as e:
+        logging.warning(f"Failed to load the cached topology {path}: {e}")
+        return None
+    if not _matches_live_system(hdl):
+        _core.topology_destroy(hdl)
+        return None
+    return hdl
+
+
+def _write_cache(path: str, io_types_filter: _core.TypeFilter | None) -> str:
+    """Run a full discovery and store the result in the cache file. Returns the XML
+    buffer."""
+
+    # Keep the disallowed resources in the cache, they are removed again at load time
+    # according to the restrictions of the loading process.
+    def _(hdl: _core.topology_t) -> None:
+        _core.topology_set_flags(hdl, _core.TopologyFlags.INCLUDE_DISALLOWED)
+        if io_types_filter is not None:
+            _core.topology_set_io_types_filter(hdl, io_types_filter)
+
+    hdl = _from_impl(_, True)
+    try:
+        xml_buffer = _core.topology_export_xmlbuffer(hdl, 0)
+    finally:
+        _core.topology_destroy(hdl)
+
+    crc = zlib.crc32(xml_buffer.encode("utf-8"))
+    dirname = os.path.dirname(path)
+    try:
+        os.makedirs(dirname, exist_ok=True)
+        # Write to a temporary file first so that concurrent readers never observe a
+        # partially written cache.
+        fd, tmp = tempfile.mkstemp(dir=dirname, suffix=".tmp")
+        try:
+            with os.fdopen(fd, "w") as fobj:
+                fobj.write(f"{_CACHE_MAGIC} {crc}\n")
+                fobj.write(xml_buffer)
+            os.replace(tmp, path)
+        except BaseException:
+            os.unlink(tmp)
+            raise
+    except OSError as e:
+        logging.warning(f"Failed to write the topology cache {path}: {e}")
+    return xml_buffer
+
+
+def _strip_io_xml(xml_buffer: str) -> str:
+    """Remove IO and Misc objects from a XML topology."""
+
+    def _(hdl: _core.topology_t) -> None:
+        # Filters are applied during the XML import.
+        _core.topology_set_xmlbuffer(hdl, xml_buffer)
+        _core.topology_set_io_types_filter(hdl, _core.TypeFilter.KEEP_NONE)
+        _core.topology_set_type_filter(
+            hdl, _core.ObjType.MISC, _core.TypeFilter.KEEP_NONE
+        )
+
+    hdl = _from_impl(_, True)
+    try:
+        return _core.topology_export_xmlbuffer(hdl, 0)
+    finally:
+        _core.topology_destroy(hdl)
+
+
 def _not_nodeset(flags: int) -> bool:
     return not bool(flags & MemBindFlags.BYNODESET)
 
@@ -110,6 +348,142 @@ RestrictFlags: TypeAlias = _core.RestrictFlags
 _BindTarget: TypeAlias = _Bitmap | set[int] | _Object
 
 
+@dataclass
+class LevelSnapshot:
+    """Columnar snapshot of all objects at a given depth, returned by
+    :py:meth:`Topology.snapshot_level`. Each column is an :py:class:`array.array`
+    indexed by the logical index of the objects. Arrays support the buffer protocol and
+    can be consumed by NumPy without copying.
+
+    Columns that don't apply to an object (like the cpuset of an I/O object) are set to
+    -1. The `parent_gp_index` of the root object is the maximum value of uint64.
+
+    """
+
+    depth: int
+    obj_type: _ObjType
+    os_index: array.array[int]
+    logical_index: array.array[int]
+    gp_index: array.array[int]
+    parent_gp_index: array.array[int]
+    cpuset_first: array.array[int]
+    cpuset_last: array.array[int]
+    cpuset_weight: array.array[int]
+    nodeset_first: array.array[int]
+
+    def __len__(self) -> int:
+        return len(self.os_index)
+
+
+class PlacementPlan(_TopoRefMixin):
+    """A set of placements returned by :py:meth:`Topology.distribute`. Each placement
+    has a cpuset and the corresponding nodeset of NUMA nodes local to the CPUs.
+
+    .. code-block::
+
+        with Topology() as topo:
+            plan = topo.distribute(len(pids))
+            plan.bind_procs(pids)
+
+    """
+
+    def __init__(self, cpusets: list[_Bitmap], topo: _TopoRef) -> None:
+        self._topo_ref = topo
+        self._cpusets = cpusets
+        self._nodesets = []
+        for cpuset in cpusets:
+            nodeset = _Bitmap()
+            _core.cpuset_to_nodeset(
+                self._topo.native_handle, cpuset.native_handle, nodeset.native_handle
+            )
+            self._nodesets.append(nodeset)
+
+    @property
+    def cpusets(self) -> list[_Bitmap]:
+        """Cpuset of each placement."""
+        return [copy(c) for c in self._cpusets]
+
+    @property
+    def nodesets(self) -> list[_Bitmap]:
+        """Nodeset of each placement."""
+        return [copy(n) for n in self._nodesets]
+
+    def __len__(self) -> int:
+        return len(self._cpusets)
+
+    def __getitem__(self, i: int) -> tuple[_Bitmap, _Bitmap]:
+        """Get the cpuset and the nodeset of the i-th placement."""
+        return copy(self._cpusets[i]), copy(self._nodesets[i])
+
+    def bind_proc(
+        self,
+        i: int,
+        pid: int,
+        policy: MemBindPolicy | None = MemBindPolicy.BIND,
+        cpubind_flags: _Flags[CpuBindFlags] = 0,
+        membind_flags: _Flags[MemBindFlags] = 0,
+    ) -> None:
+        """Bind a process to the CPUs and the memory of the i-th placement.
+
+        Parameters
+        ----------
+        i :
+            Index of the placement.
+        pid :
+            Process ID to bind.
+        policy :
+            Memory binding policy. Set to None to skip the memory binding.
+        cpubind_flags :
+            Flags for :py:meth:`Topology.set_proc_cpubind`.
+        membind_flags :
+            Flags for :py:meth:`Topology.set_proc_membind`, the nodeset flag is
+            implied.
+        """
+        topo = self._topo
+        topo.set_proc_cpubind(pid, self._cpusets[i], cpubind_flags)
+        if policy is not None:
+            flags = _or_flags(membind_flags) | MemBindFlags.BYNODESET
+            topo.set_proc_membind(pid, self._nodesets[i], policy, flags)
+
+    def bind_procs(
+        self,
+        pids: Sequence[int],
+        policy: MemBindPolicy | None = MemBindPolicy.BIND,
+        cpubind_flags: _Flags[CpuBindFlags] = 0,
+        membind_flags: _Flags[MemBindFlags] = 0,
+    ) -> None:
+        """Bind the i-th process to the i-th placement. See :py:meth:`bind_proc`."""
+        if len(pids) > len(self):
+            raise ValueError(
+                f"Got {len(pids)} processes for a plan of {len(self)} placements."
+            )
+        for i, pid in enumerate(pids):
+            self.bind_proc(i, pid, policy, cpubind_flags, membind_flags)
+
+    def bind_current_thread(
+        self,
+        i: int,
+        policy: MemBindPolicy | None = MemBindPolicy.BIND,
+    ) -> None:
+        """Bind the current thread to the CPUs and the memory of the i-th placement.
+
+        Parameters
+        ----------
+        i :
+            Index of the placement.
+        policy :
+            Memory binding policy. Set to None to skip the memory binding.
+        """
+        topo = self._topo
+        topo.set_cpubind(self._cpusets[i], CpuBindFlags.THREAD)
+        if policy is not None:
+            flags = MemBindFlags.THREAD | MemBindFlags.BYNODESET
+            topo.set_membind(self._nodesets[i], policy, flags)
+
+    def __repr__(self) -> str:
+        return f"PlacementPlan({[str(c) for c in self._cpusets]})"
+
+
 class Topology:
     """High-level interface for the hwloc topology.
 
@@ -121,6 +495,7 @@ class Topology:
     current system. For alternative topology sources, use the class methods:
 
     - :meth:`from_this_system`
+    - :meth:`from_cached_system`
     - :meth:`from_pid`
     - :meth:`from_synthetic`
     - :meth:`from_xml_file`
@@ -174,6 +549,12 @@ class Topology:
         with Topology() as topo:
             print(f"Topology depth: {topo.depth}")
 
+    Read-only methods of a loaded topology, and of the objects obtained from it, can be
+    called from multiple threads concurrently, the GIL is released during the native
+    calls. Methods that modify the topology, like :meth:`restrict`, :meth:`allow`,
+    :meth:`refresh` and :meth:`destroy`, require exclusive access. See
+    :ref:`thread-safety` for details.
+
     """
 
     def __init__(self) -> None:
@@ -191,6 +572,22 @@ class Topology:
         self._loaded = True
         # See the distance release method for more info.
         self._cleanup: list[weakref.ReferenceType[_distances.Distances]] = []
+        # Memory allocated by `alloc_membind` and memory pools.
+        self._allocations: weakref.WeakSet[_MemBindBuffer | _MemBindPool] = (
+            weakref.WeakSet()
+        )
+        # Memoized XML export for pickling, see `__getstate__`.
+        self._xml_memo: str | None = None
+        self._strip_io = False
+        # Identity map of objects keyed by the global persistent index, see `_object`.
+        self._objects: dict[int, _Object] = {}
+        self._locality: _LocalityIndex | None = None
+        # Locality of GPUs by interoperability module, see `_get_all_devices`.
+        self._device_tables: dict[str, list[DeviceLocality]] = {}
+        # Number of modifications, for caches living outside of the topology.
+        self._generation = 0
+        # Guards the Python state shared by threads, see the thread safety notes.
+        self._lock = threading.RLock()
 
     @classmethod
     def from_native_handle(cls, hdl: _core.topology_t, is_loaded: bool) -> Topology:
@@ -198,6 +595,14 @@ class Topology:
         topo._hdl = hdl
         topo._loaded = is_loaded
         topo._cleanup = []
+        topo._allocations = weakref.WeakSet()
+        topo._xml_memo = None
+        topo._strip_io = False
+        topo._objects = {}
+        topo._locality = None
+        topo._device_tables = {}
+        topo._generation = 0
+        topo._lock = threading.RLock()
         return topo
 
     @classmethod
@@ -221,6 +626,109 @@ class Topology:
         hdl = _from_impl(_, load)
         return cls.from_native_handle(hdl, load)
 
+    @classmethod
+    async def from_this_system_async(cls) -> Topology:
+        """Create and load a topology from this system without blocking the event
+        loop, see :py:meth:`aload`.
+
+        """
+        return await cls.from_this_system().aload()
+
+    @classmethod
+    def from_this_system_staged(
+        cls, io_types_filter: TypeFilter = TypeFilter.KEEP_IMPORTANT
+    ) -> tuple[Topology, Future[Topology]]:
+        """Load this system in two passes so that the CPU and memory levels are
+        available before the I/O discovery finishes. The first pass loads a topology
+        without I/O objects, which skips the PCI discovery. The second pass loads
+        another topology with the I/O objects in a background thread, it starts before
+        the first pass and runs concurrently.
+
+        Objects of the two topologies are not interchangeable, consumers switch to the
+        second topology once it's available. Use :py:func:`asyncio.wrap_future` to
+        await it in asynchronous code.
+
+        .. code-block::
+
+            topo, future = Topology.from_this_system_staged()
+            # Start scheduling with the CPUs and NUMA nodes.
+            n_cores = topo.n_cores()
+            # Wait for the I/O devices.
+            full = future.result()
+            topo.destroy()
+
+        Parameters
+        ----------
+        io_types_filter :
+            Filter for the I/O objects of the second pass, see
+            :py:meth:`set_io_types_filter`.
+
+        Returns
+        -------
+        The topology without I/O objects, and a future of the complete topology.
+        """
+
+        def load_io() -> Topology:
+            return cls.from_this_system().set_io_types_filter(io_types_filter).load()
+
+        executor = ThreadPoolExecutor(max_workers=1, thread_name_prefix="pyhwloc-io")
+        future = executor.submit(load_io)
+        executor.shutdown(wait=False)
+        try:
+            topo = (
+                cls.from_this_system().set_io_types_filter(TypeFilter.KEEP_NONE).load()
+            )
+        except BaseException:
+            # Nobody else holds the future, release the second topology as well.
+            if not future.cancel() and future.exception() is None:
+                future.result().destroy()
+            raise
+        return topo, future
+
+    @classmethod
+    def from_cached_system(
+        cls,
+        cache_dir: os.PathLike | str | None = None,
+        *,
+        io_types_filter: TypeFilter | None = None,
+    ) -> Topology:
+        """Create a loaded topology of this system, using an on-disk XML cache to skip
+        the discovery when possible.
+
+        The first call runs a full discovery and stores the result in the cache.
+        Subsequent calls load the XML with the :py:attr:`TopologyFlags.IS_THISSYSTEM`
+        and :py:attr:`TopologyFlags.THISSYSTEM_ALLOWED_RESOURCES` flags, which is
+        significantly faster for short-lived processes. The cache is keyed by the host
+        name, the boot ID, the online CPUs, and the hwloc API version. It's discarded if
+        the XML fails to validate, or if the CPUs the process may run on or the online
+        NUMA nodes are missing from the cached topology.
+
+        Apart from the IO filter, the topology is discovered with default filters, use
+        :py:meth:`from_this_system` if you need to customize the discovery further.
+
+        Parameters
+        ----------
+        cache_dir :
+            Directory to store the cache. Defaults to the ``PYHWLOC_CACHE_DIR``
+            environment variable if set, or ``pyhwloc`` under the user cache directory.
+        io_types_filter :
+            Filter for IO objects, see :py:meth:`set_io_types_filter`. Each filter has
+            its own cache entry.
+
+        Returns
+        -------
+        New loaded Topology instance for this system.
+        """
+        if cache_dir is None:
+            cache_dir = _default_cache_dir()
+        dirname = os.fspath(os.path.expanduser(cache_dir))
+        path = os.path.join(dirname, f"{_system_cache_key(io_types_filter)}.xml")
+
+        hdl = _from_cache(path)
+        if hdl is None:
+            hdl = _from_cached_xml(_write_cache(path, io_types_filter))
+        return cls.from_native_handle(hdl, True)
+
     @classmethod
     def from_pid(cls, pid: int, *, load: bool = False) -> Topology:
         """Create a topology from a specific process ID.
@@ -284,13 +792,111 @@ class Topology:
         return cls.from_native_handle(hdl, load)
 
     @classmethod
-    def from_xml_buffer(cls, xml_buffer: str, *, load: bool = False) -> Topology:
-        """Create a topology from a XML string.
+    def from_xml_files(
+        cls,
+        xml_paths: Sequence[os.PathLike | str],
+        *,
+        io_types_filter: TypeFilter | None = None,
+        flags: _Flags[TopologyFlags] = 0,
+        max_workers: int | None = None,
+    ) -> list[Topology]:
+        """Create loaded topologies from many XML files in parallel.
+
+        The files are read and parsed by hwloc in a thread pool without holding the
+        GIL, no Python string is created for the XML documents. If any of the files
+        fails to load, the other topologies are destroyed and the first error is raised.
+
+        .. code-block::
+
+            topos = Topology.from_xml_files(["node0.xml", "node1.xml"])
+            try:
+                total = sum(topo.n_cpus() for topo in topos)
+            finally:
+                for topo in topos:
+                    topo.destroy()
+
+        Parameters
+        ----------
+        xml_paths :
+            Paths to the XML files.
+        io_types_filter :
+            Filter for IO objects, see :py:meth:`set_io_types_filter`. IO objects are
+            not imported if it's not specified.
+        flags :
+            Topology flags, see :py:meth:`set_flags`.
+        max_workers :
+            Number of threads, see :py:class:`concurrent.futures.ThreadPoolExecutor`.
+
+        Returns
+        -------
+        New loaded Topology instances, in the same order as the paths.
+        """
+        paths = [os.fspath(os.path.expanduser(p)) for p in xml_paths]
+        handles = _from_xml_files(paths, io_types_filter, _or_flags(flags), max_workers)
+        return [cls.from_native_handle(hdl, True) for hdl in handles]
+
+    @classmethod
+    def from_xml_dir(
+        cls,
+        dirname: os.PathLike | str,
+        pattern: str = "*.xml",
+        *,
+        io_types_filter: TypeFilter | None = None,
+        flags: _Flags[TopologyFlags] = 0,
+        max_workers: int | None = None,
+    ) -> dict[str, Topology]:
+        """Create loaded topologies from the XML files in a directory, like the exports
+        of the nodes of a cluster. See :py:meth:`from_xml_files` for details.
+
+        Parameters
+        ----------
+        dirname :
+            Directory containing the XML files. Sub-directories are not searched.
+        pattern :
+            Pattern of the file names, see :py:func:`fnmatch.fnmatch`.
+        io_types_filter :
+            Filter for IO objects, see :py:meth:`set_io_types_filter`.
+        flags :
+            Topology flags, see :py:meth:`set_flags`.
+        max_workers :
+            Number of threads, see :py:class:`concurrent.futures.ThreadPoolExecutor`.
+
+        Returns
+        -------
+        New loaded Topology instances keyed by the file names without the extension,
+        sorted by name.
+        """
+        dirname = os.fspath(os.path.expanduser(dirname))
+        names = _list_xml_dir(dirname, pattern)
+        paths = [os.path.join(dirname, name) for name in names]
+        handles = _from_xml_files(paths, io_types_filter, _or_flags(flags), max_workers)
+        return {
+            os.path.splitext(name)[0]: cls.from_native_handle(hdl, True)
+            for name, hdl in zip(names, handles)
+        }
+
+    @classmethod
+    def from_xml_buffer(
+        cls, xml_buffer: str | Buffer, *, load: bool = False
+    ) -> Topology:
+        """Create a topology from a XML string or buffer.
+
+        Apart from :py:class:`str`, the buffer is passed to hwloc without any copy or
+        decoding, including :py:class:`bytes`, :py:class:`memoryview` and
+        :py:class:`mmap.mmap`:
+
+        .. code-block::
+
+            with open("topology.xml", "rb") as fd:
+                with mmap.mmap(fd.fileno(), 0, access=mmap.ACCESS_READ) as buf:
+                    topo = Topology.from_xml_buffer(buf, load=True)
 
         Parameters
         ----------
         xml_buffer
-            XML string containing topology
+            XML string containing topology, or a contiguous buffer of the UTF-8 encoded
+            XML document. hwloc doesn't keep a reference to the buffer, it can be
+            closed once this function returns.
         load :
             Whether the object should load the topology from the system. Set to False if
             you want to apply additional filters.
@@ -313,6 +919,23 @@ class Topology:
             self._loaded = True
         return self
 
+    async def aload(self) -> Topology:
+        """Asynchronous version of :py:meth:`load`. The discovery runs in the default
+        executor of the running event loop, the GIL is released during the native call.
+        The topology must not be used until the load finishes. No-op if it's already
+        loaded.
+
+        .. code-block::
+
+            topo = await Topology.from_this_system().set_io_types_filter(
+                TypeFilter.KEEP_ALL
+            ).aload()
+
+        """
+        if not self.is_loaded:
+            await asyncio.to_thread(self.load)
+        return self
+
     @property
     def native_handle(self) -> _core.topology_t:
         """Get the native hwloc topology handle."""
@@ -403,11 +1026,23 @@ class Topology:
     def destroy(self) -> None:
         """Explicitly destroy the topology and free resources."""
         while self._cleanup:
-            dist_ref = self._cleanup.pop()
-            dist = dist_ref()
+            # Only pop after a successful release so that the destroy can be retried.
+            dist = self._cleanup[-1]()
             if dist:
                 dist.release()
+            self._cleanup.pop()
+        if self._allocations:
+            from .memory import MemBindPool
+
+            # Buffers first as they might return memory to pools.
+            allocations = sorted(
+                self._allocations, key=lambda a: isinstance(a, MemBindPool)
+            )
+            for alloc in allocations:
+                alloc.release()
 
+        with self._lock:
+            self._clear_objects()
         if hasattr(self, "_hdl"):
             _core.topology_destroy(self.native_handle)
             self._loaded = False
@@ -440,10 +1075,23 @@ class Topology:
         return self.__copy__()
 
     def __getstate__(self) -> dict:
-        """Serialize topology state for pickling using XML export."""
-        # Export topology to XML for serialization
-        xml_buffer = self.export_xml_buffer(0)  # Use default flags
-        return {"xml_buffer": xml_buffer}
+        """Serialize topology state for pickling using XML export.
+
+        The XML export is memoized, pickling the same topology multiple times only
+        exports it once. The memo is reset by the methods of pyhwloc that modify a
+        loaded topology, including :py:meth:`restrict`, :py:meth:`allow` and
+        :py:meth:`refresh`. Modifications made through the low-level API are not
+        tracked.
+
+        """
+        xml_buffer = self._xml_memo
+        if xml_buffer is None:
+            # Export topology to XML for serialization
+            xml_buffer = self.export_xml_buffer(0)  # Use default flags
+            if self._strip_io:
+                xml_buffer = _strip_io_xml(xml_buffer)
+            self._xml_memo = xml_buffer
+        return {"xml_buffer": xml_buffer, "strip_io": self._strip_io}
 
     def __setstate__(self, state: dict) -> None:
         """Restore topology state from pickle using XML import."""
@@ -454,6 +1102,61 @@ class Topology:
         self._hdl = hdl
         self._loaded = True
         self._cleanup = []
+        self._allocations = weakref.WeakSet()
+        # The restored topology can be pickled again without an export.
+        self._xml_memo = xml_buffer
+        self._strip_io = state.get("strip_io", False)
+        self._objects = {}
+        self._locality = None
+        self._device_tables = {}
+        self._generation = 0
+        self._lock = threading.RLock()
+
+    def set_pickle_options(self, *, strip_io: bool = False) -> Topology:
+        """Configure how the topology is serialized by :py:mod:`pickle`.
+
+        Parameters
+        ----------
+        strip_io :
+            Remove the IO objects (bridges, PCI and OS devices) and the Misc objects
+            from the pickled topology. They can be the bulk of the XML on nodes with
+            many devices, and are often not needed by workers. The topology itself is
+            not modified.
+
+        Returns
+        -------
+        The topology itself.
+        """
+        if strip_io != self._strip_io:
+            self._strip_io = strip_io
+            self._xml_memo = None
+        return self
+
+    def _modified(self, objects: bool = True) -> None:
+        # Called by methods that modify a loaded topology to invalidate the memoized
+        # state. `objects` is False when the tree itself is unchanged, like when only
+        # the allowed sets or the attributes are modified. Objects and the caches
+        # derived from the tree are kept.
+        #
+        # The internal caches of hwloc (distances, memory attributes) are refreshed
+        # eagerly. Otherwise, they are refreshed lazily by the next query, which is not
+        # thread-safe.
+        _core.topology_refresh(self.native_handle)
+        with self._lock:
+            self._xml_memo = None
+            self._generation += 1
+            if objects:
+                self._locality = None
+                self._device_tables = {}
+            self._clear_objects(keep=not objects)
+
+    def _clear_objects(self, keep: bool = False) -> None:
+        # Objects might have been removed or re-indexed. Users can still hold the old
+        # objects, reset their memos as well.
+        for obj in self._objects.values():
+            obj._memo.clear()
+        if not keep:
+            self._objects.clear()
 
     def _checked_apply(self, fn: Callable, values: int) -> Topology:
         # If we don't raise here, hwloc returns EBUSY: Device or resource busy, which is
@@ -511,6 +1214,7 @@ class Topology:
         _core.topology_restrict(
             self.native_handle, cpuset.native_handle, _or_flags(flags)
         )
+        self._modified()
 
     @_reuse_doc(_core.topology_allow)
     def allow(
@@ -524,10 +1228,67 @@ class Topology:
         _core.topology_allow(
             self.native_handle, cpuset_hdl, nodeset_hdl, _or_flags(flags)
         )
+        self._modified(objects=False)
+
+    def refresh_allowed(self) -> bool:
+        """Re-read the CPUs and NUMA nodes available to the current process, for
+        example after a change of its cgroup, without rediscovering the topology. Only
+        the :py:attr:`allowed_cpuset` and the :py:attr:`allowed_nodeset` are updated,
+        objects obtained from the topology remain valid.
+
+        The topology must be loaded from this system with the
+        :py:attr:`TopologyFlags.INCLUDE_DISALLOWED` flag so that it contains the
+        resources that can become available later.
+
+        .. code-block::
+
+            topo = Topology.from_this_system().set_flags(
+                TopologyFlags.INCLUDE_DISALLOWED
+            ).load()
+            # After the cgroup of the process is modified.
+            if topo.refresh_allowed():
+                print(topo.allowed_cpuset)
+
+        Returns
+        -------
+        Whether the allowed cpuset or nodeset has changed.
+        """
+        if not self.get_flags() & TopologyFlags.INCLUDE_DISALLOWED:
+            raise ValueError(
+                "The topology must be loaded with `TopologyFlags.INCLUDE_DISALLOWED`."
+            )
+        cpuset, nodeset = self.allowed_cpuset, self.allowed_nodeset
+        _core.topology_allow(
+            self.native_handle, None, None, AllowFlags.LOCAL_RESTRICTIONS
+        )
+        if cpuset == self.allowed_cpuset and nodeset == self.allowed_nodeset:
+            return False
+        self._modified(objects=False)
+        return True
 
     @_reuse_doc(_core.topology_refresh)
     def refresh(self) -> None:
-        _core.topology_refresh(self.native_handle)
+        # The topology is refreshed by `_modified`. Refreshing doesn't change the tree,
+        # objects and the caches derived from it are kept.
+        self._modified(objects=False)
+
+    def diff(self, other: Topology) -> _TopologyDiff:
+        """Compute the differences between this topology and `other` with
+        :py:func:`~pyhwloc.hwloc.core.topology_diff_build`, see
+        :py:class:`~pyhwloc.diff.TopologyDiff`. Applying the result to this topology
+        makes its object attributes identical to `other`.
+
+        A diff without any ``TOO_COMPLEX`` entry means that the topologies have the
+        same structure, objects held by the caller can be kept and the attributes
+        updated with :py:meth:`~pyhwloc.diff.TopologyDiff.apply`, instead of replacing
+        the topology.
+
+        """
+        from .diff import TopologyDiff
+
+        return TopologyDiff(
+            _core.topology_diff_build(self.native_handle, other.native_handle)
+        )
 
     def get_obj_by_depth(self, depth: int, idx: int) -> _Object | None:
         """Get object at specific depth and index.
@@ -614,6 +1375,59 @@ class Topology:
             yield obj
             prev = ptr
 
+    def snapshot_level(self, depth: int) -> LevelSnapshot:
+        """Export commonly used attributes of all objects at a specific depth with a
+        single native call. Prefer this over :py:meth:`iter_objs_by_depth` when only
+        indices and cpuset bounds are needed for a large number of objects.
+
+        Parameters
+        ----------
+        depth
+            Depth level in topology tree, special depths like
+            :py:attr:`~pyhwloc.hwobject.GetTypeDepth.NUMANODE` are accepted.
+
+        Returns
+        -------
+        A :py:class:`LevelSnapshot` with one entry for each object.
+        """
+        obj_type = self.get_depth_type(depth)
+        n = self.get_nbobjs_by_depth(depth)
+
+        def zeros(typecode: str) -> array.array[int]:
+            return array.array(typecode, [0]) * n
+
+        snapshot = LevelSnapshot(
+            depth=depth,
+            obj_type=obj_type,
+            os_index=zeros("I"),
+            logical_index=zeros("I"),
+            gp_index=zeros("Q"),
+            parent_gp_index=zeros("Q"),
+            cpuset_first=zeros("i"),
+            cpuset_last=zeros("i"),
+            cpuset_weight=zeros("i"),
+            nodeset_first=zeros("i"),
+        )
+
+        columns = _core.LevelSnapshot()
+        columns.os_index = _array_ptr(snapshot.os_index, ctypes.c_uint)
+        columns.logical_index = _array_ptr(snapshot.logical_index, ctypes.c_uint)
+        columns.gp_index = _array_ptr(snapshot.gp_index, _core.hwloc_uint64_t)
+        columns.parent_gp_index = _array_ptr(
+            snapshot.parent_gp_index, _core.hwloc_uint64_t
+        )
+        columns.cpuset_first = _array_ptr(snapshot.cpuset_first, ctypes.c_int)
+        columns.cpuset_last = _array_ptr(snapshot.cpuset_last, ctypes.c_int)
+        columns.cpuset_weight = _array_ptr(snapshot.cpuset_weight, ctypes.c_int)
+        columns.nodeset_first = _array_ptr(snapshot.nodeset_first, ctypes.c_int)
+
+        n_written = _core.snapshot_level(self.native_handle, depth, columns, n)
+        if n_written != n:
+            raise RuntimeError(
+                f"Expected {n} objects at depth {depth}, the snapshot has {n_written}."
+            )
+        return snapshot
+
     def n_cores(self) -> int:
         """Get the total number of cores.
 
@@ -799,6 +1613,172 @@ class Topology:
         """
         return self.get_nbobjs_by_type(_ObjType.OS_DEVICE)
 
+    def locality_index(self) -> _LocalityIndex:
+        """Get the precomputed locality lookup tables of this topology, see
+        :py:class:`~pyhwloc.locality.LocalityIndex`. The index is built on the first
+        call and reused until the topology is modified. OS devices are only indexed if
+        they are kept by the IO type filter.
+
+        """
+        with self._lock:
+            if self._locality is None:
+                from .locality import LocalityIndex
+
+                self._locality = LocalityIndex(self)
+            return self._locality
+
+    def io_affinity_matrix(
+        self,
+        kinds: Sequence[_hwobject.ObjOsdevType] | None = (
+            _hwobject.ObjOsdevType.GPU,
+            _hwobject.ObjOsdevType.NETWORK,
+            _hwobject.ObjOsdevType.STORAGE,
+        ),
+    ) -> _IoAffinityMatrix:
+        """Compute the hop counts, the kind of common ancestors, and the PCI link
+        bottlenecks between all pairs of OS devices, see
+        :py:class:`~pyhwloc.locality.IoAffinityMatrix`. This can be used to select the
+        closest NIC or storage for each GPU. The IO types filter needs to keep the
+        devices, see :py:meth:`set_io_types_filter`.
+
+        Parameters
+        ----------
+        kinds :
+            Types of the OS devices to include. All OS devices are included if it's
+            None.
+        """
+        from .locality import IoAffinityMatrix, _io_devices
+
+        return IoAffinityMatrix(_io_devices(list(self.iter_os_devices()), kinds))
+
+    def view(self, cpuset: _Bitmap | set[int]) -> _TopologyView:
+        """Get a read-only view of this topology restricted to a cpuset, see
+        :py:class:`~pyhwloc.view.TopologyView`. Unlike :py:meth:`restrict`, the
+        topology is neither modified nor duplicated, creating a view only copies the
+        cpuset.
+
+        """
+        from .view import TopologyView
+
+        return TopologyView(self, cpuset)
+
+    def core_allocator(
+        self, unit: _ObjType = _ObjType.CORE, *, group: _ObjType = _ObjType.L3CACHE
+    ) -> _CoreAllocator:
+        """Create an allocator handing out exclusive units of the allowed CPUs, see
+        :py:class:`~pyhwloc.allocator.CoreAllocator`. Each call returns a new allocator
+        with all units free.
+
+        Parameters
+        ----------
+        unit :
+            Type of the allocated objects, like cores, PUs or L3 caches.
+        group :
+            Type of the objects to pack the units into before spreading.
+        """
+        from .allocator import CoreAllocator
+
+        return CoreAllocator(self, unit, group=group)
+
+    def singlify_per_core(self, cpuset: _Bitmap, which: int = 0) -> _Bitmap:
+        """Keep a single PU in each core of a cpuset, for running one thread per
+        physical core. See :py:func:`~pyhwloc.hwloc.core.bitmap_singlify_per_core`.
+
+        Parameters
+        ----------
+        cpuset :
+            The CPUs to reduce, it's not modified.
+        which :
+            Index of the PU to keep among the PUs of each core in the cpuset. Cores
+            without enough PUs in the cpuset are removed.
+
+        Returns
+        -------
+        A new cpuset.
+        """
+        result = copy(cpuset)
+        _core.bitmap_singlify_per_core(self.native_handle, result.native_handle, which)
+        return result
+
+    def cache_profile(self, cpuset: _Bitmap | set[int] | None = None) -> _CacheProfile:
+        """Get the effective data cache capacity per thread at each level for the
+        threads running on a cpuset, along with suggested blocking sizes, see
+        :py:class:`~pyhwloc.caches.CacheProfile`.
+
+        Parameters
+        ----------
+        cpuset :
+            The CPUs of the threads, one thread per PU. Defaults to the allowed CPUs of
+            the topology.
+        """
+        from .caches import CacheProfile
+
+        if cpuset is None:
+            cpuset = self.allowed_cpuset
+        return CacheProfile(self, cpuset)
+
+    def placement_monitor(
+        self, *, interval: float = 1.0, capacity: int = 1024
+    ) -> _PlacementMonitor:
+        """Create a monitor sampling the CPU and memory locality of processes, threads
+        and buffers, see :py:class:`~pyhwloc.monitor.PlacementMonitor`. The topology
+        must be loaded from this system.
+
+        Parameters
+        ----------
+        interval :
+            Time between two samples in seconds for the background thread.
+        capacity :
+            Number of samples kept in the ring buffer.
+        """
+        from .monitor import PlacementMonitor
+
+        return PlacementMonitor(self, interval=interval, capacity=capacity)
+
+    def _get_all_devices(
+        self, module: str, count: Callable[[], int], fill: Callable[..., None]
+    ) -> list[DeviceLocality]:
+        # Shared by the `get_all_devices` functions of the interoperability modules,
+        # `fill` is one of the batched `get_devices` functions of the low-level API.
+        table = self._device_tables.get(module)
+        if table is None:
+            n = count()
+            topo_ref = weakref.ref(self)
+            cpusets = [_Bitmap() for _ in range(n)]
+            nodesets = [_Bitmap() for _ in range(n)]
+            pci_ids = (ctypes.c_int * (3 * n))()
+            osdevs = (_core.obj_t * n)()
+            fill(
+                self.native_handle,
+                n,
+                (_core.hwloc_cpuset_t * n)(*[c.native_handle for c in cpusets]),
+                (_core.hwloc_nodeset_t * n)(*[c.native_handle for c in nodesets]),
+                pci_ids,
+                osdevs,
+            )
+            table = [
+                DeviceLocality(
+                    i,
+                    cpusets[i],
+                    nodesets[i],
+                    PciId(*pci_ids[3 * i : 3 * i + 3]),
+                    (
+                        cast(_hwobject.OsDevice, _object(osdevs[i], topo_ref))
+                        if osdevs[i]
+                        else None
+                    ),
+                )
+                for i in range(n)
+            ]
+            # Another thread might have filled the table concurrently.
+            with self._lock:
+                table = self._device_tables.setdefault(module, table)
+        # Bitmaps are mutable.
+        return [
+            replace(d, cpuset=copy(d.cpuset), nodeset=copy(d.nodeset))
+            for d in table
+        ]
+
     # Distance Methods
     @_reuse_doc(_core.distances_get)
     def get_distances(
@@ -834,12 +1814,13 @@ class Topology:
 
         # Push into the cleanup queue. We also perform some cleanups here to avoid
         # having too many references.
-        still_valid = []
-        for ref in self._cleanup:
-            if ref() is not None:
-                still_valid.append(ref)
-        self._cleanup = still_valid
-        self._cleanup.extend([weakref.ref(dist) for dist in result])
+        with self._lock:
+            still_valid = []
+            for ref in self._cleanup:
+                if ref() is not None:
+                    still_valid.append(ref)
+            self._cleanup = still_valid
+            self._cleanup.extend([weakref.ref(dist) for dist in result])
 
         return result
 
@@ -1020,9 +2001,77 @@ class Topology:
         )
         return bitmap, policy
 
-    # Allocator interface is not exposed. I checked popular libraries like torch, none
-    # of them supports setting custom allocator in Python. We can come back to this if
-    # someone asks for it.
+    def get_area_memlocation(
+        self,
+        mem: memoryview,
+        flags: _Flags[MemBindFlags] = 0,
+    ) -> _Bitmap:
+        """Get the NUMA nodes where the memory area is physically allocated.
+
+        Parameters
+        ----------
+        mem
+            Memory area. Use :py:func:`~pyhwloc.utils.memoryview_from_memory` to
+            construct a :py:class:`memoryview` if you have pointers.
+        flags
+            Flags for getting memory location.
+
+        Returns
+        -------
+        Bitmap of the location, a nodeset if the
+        :py:attr:`~pyhwloc.topology.MemBindFlags.BYNODESET` is specified, cpuset
+        otherwise.
+        """
+        bitmap = _Bitmap()
+        addr, size = _memview_to_mem(mem)
+        _core.get_area_memlocation(
+            self.native_handle, addr, size, bitmap.native_handle, _or_flags(flags)
+        )
+        return bitmap
+
+    def alloc_membind(
+        self,
+        nbytes: int,
+        target: _BindTarget,
+        policy: MemBindPolicy,
+        flags: _Flags[MemBindFlags] = 0,
+    ) -> _MemBindBuffer:
+        """Allocate a buffer bound to the specified NUMA nodes. Binding falls back to
+        other methods when the allocation with a binding is not supported, see
+        :py:func:`pyhwloc.hwloc.core.alloc_membind_policy`.
+
+        Parameters
+        ----------
+        nbytes
+            Size of the buffer in bytes.
+        target
+            NUMA nodes to bind memory to. This can be an
+            :py:class:`~pyhwloc.hwobject.Object`, a :py:class:`~pyhwloc.bitmap.Bitmap`,
+            or a CPU set used by the `os.sched_*` routines (:py:class:`set` [int]).
+        policy
+            Memory binding policy to use
+        flags
+            Additional flags for memory binding.
+
+        Returns
+        -------
+        A :py:class:`~pyhwloc.memory.MemBindBuffer` that owns the memory. It supports
+        the buffer protocol and the NumPy array interface. Use
+        :py:class:`~pyhwloc.memory.MemBindPool` to reuse memory across allocations.
+        """
+        from .memory import MemBindBuffer
+
+        if nbytes <= 0:
+            raise ValueError("Size of the buffer must be positive.")
+        flags = _or_flags(flags)
+        bitmap = _to_bitmap(target, _not_nodeset(flags))
+        addr = _core.alloc_membind_policy(
+            self.native_handle, nbytes, bitmap.native_handle, policy, flags
+        )
+        return MemBindBuffer(addr, nbytes, nbytes, weakref.ref(self))
+
+    # Custom allocators for libraries like torch are not exposed, see the
+    # `alloc_membind` and the `pyhwloc.memory` module for owning buffers instead.
 
     # CPU Binding Methods
     def set_cpubind(self, target: _BindTarget, flags: _Flags[CpuBindFlags] = 0) -> None:
@@ -1227,6 +2276,90 @@ class Topology:
             if hdl:
                 _core._close_proc_handle(hdl)
 
+    # Distributing items
+    def distribute(
+        self,
+        n: int,
+        roots: Sequence[_Object] | None = None,
+        until: _ObjType = _ObjType.PU,
+        max_per_core: int | None = None,
+        reverse: bool = False,
+        kind: int | None = None,
+    ) -> PlacementPlan:
+        """Distribute `n` items over the topology, see
+        :py:func:`pyhwloc.hwloc.core.distrib`. This is typically used to spread
+        processes or threads evenly across the machine.
+
+        Parameters
+        ----------
+        n :
+            Number of items.
+        roots :
+            Objects to distribute the items over. Defaults to the root object.
+        until :
+            Stop dividing at the depth of this type (or below if the type is not
+            present).
+        max_per_core :
+            Maximum number of items that can share a core. A :py:class:`ValueError` is
+            raised if the roots don't have enough cores.
+        reverse :
+            Distribute from the last objects first.
+        kind :
+            Rank of a CPU kind in :py:meth:`~pyhwloc.cpukinds.CpuKinds.partition`, 0 for
+            the most performant kind. The items are distributed over the largest
+            objects covering the allowed CPUs of that kind. Cannot be used with
+            `roots`.
+
+        Returns
+        -------
+        A plan with one cpuset for each item. The cpusets may contain multiple PUs, use
+        :py:meth:`~pyhwloc.bitmap.Bitmap.singlify` to avoid migration between them.
+        """
+        if n < 1:
+            raise ValueError("Number of items must be positive.")
+        if kind is not None:
+            if roots is not None:
+                raise ValueError("`roots` and `kind` are mutually exclusive.")
+            kinds = self.get_cpukinds().partition()
+            if not 0 <= kind < len(kinds):
+                raise IndexError(f"Invalid CPU kind rank: {kind}")
+            roots = self.view(kinds[kind].cpuset).get_largest_objs()
+        if roots is None:
+            roots = [self.get_root_obj()]
+        if not roots:
+            raise ValueError("`roots` cannot be empty.")
+
+        if max_per_core is not None:
+            cpuset = _Bitmap.reduce_or([r.cpuset for r in roots if r.cpuset])
+            n_cores = _core.get_nbobjs_inside_cpuset_by_type(
+                self.native_handle, cpuset.native_handle, _ObjType.CORE
+            )
+            if n > n_cores * max_per_core:
+                raise ValueError(
+                    f"Cannot place {n} items with at most {max_per_core} per core on "
+                    f"{n_cores} cores."
+                )
+
+        depth = _core.get_type_or_below_depth(self.native_handle, until)
+        if depth < 0:
+            raise ValueError(f"Invalid type for `until`: {until.name}")
+
+        c_roots = (_core.obj_t * len(roots))(*[r.native_handle for r in roots])
+        # hwloc allocates the cpusets, we take the ownership.
+        c_sets = (_core.hwloc_cpuset_t * n)()
+        flags = _core.DistribFlags.REVERSE if reverse else 0
+        try:
+            _core.distrib(
+                self.native_handle, c_roots, len(roots), c_sets, n, depth, flags
+            )
+        finally:
+            cpusets = [
+                _Bitmap.from_native_handle(_core.hwloc_cpuset_t(c), own=True)
+                for c in c_sets
+                if c
+            ]
+        return PlacementPlan(cpusets, weakref.ref(self))
+
     def get_cpukinds(self) -> CpuKinds:
         """Get a proxy object for the CPU kinds."""
         return CpuKinds(weakref.ref(self))
@@ -1263,6 +2396,8 @@ if not _lib._IS_DOC_BUILD:
 
 from_this_system = Topology.from_this_system
 
+from_cached_system = Topology.from_cached_system
+
 from_pid = Topology.from_pid
 
 from_synthetic = Topology.from_synthetic
@@ -7,11 +7,13 @@ Utilities
 
 from __future__ import annotations
 
+import array
 import ctypes
 from collections.abc import Sequence
 from dataclasses import dataclass
 from typing import (
     TYPE_CHECKING,
+    Any,
     Callable,
     ParamSpec,
     Protocol,
@@ -20,7 +22,7 @@ from typing import (
     Union,
 )
 
-__all__ = ["PciId", "memoryview_from_memory"]
+__all__ = ["PciId", "DeviceLocality", "memoryview_from_memory"]
 
 _P = ParamSpec("_P")
 _R = TypeVar("_R")
@@ -29,7 +31,9 @@ _R = TypeVar("_R")
 if TYPE_CHECKING:
     import weakref
 
+    from .bitmap import Bitmap
     from .hwloc import core as _core
+    from .hwobject import OsDevice
     from .topology import Topology
 
     _TopoRef: TypeAlias = weakref.ReferenceType[Topology]
@@ -101,6 +105,21 @@ def _memview_to_mem(mem: memoryview) -> tuple[ctypes.c_void_p, int]:
     return addr, size
 
 
+def _array_ptr(arr: array.array[int], ctype: type) -> Any:
+    """Get a typed pointer to the underlying storage of an array."""
+    addr, _ = arr.buffer_info()
+    return ctypes.cast(addr, ctypes.POINTER(ctype))
+
+
+def _matrix_view(items: array.array, rows: int, cols: int) -> memoryview:
+    """Get a read-only 2-dimensional view of a row-major array."""
+    view = memoryview(items)
+    if rows == 0 or cols == 0:
+        # A memoryview cannot be cast to a shape with zeros.
+        return view.toreadonly()
+    return view.cast("B").cast(items.typecode, [rows, cols]).toreadonly()
+
+
 class _HasTopoRef(Protocol):
     @property
     def _topo_ref(self) -> _TopoRef: ...
@@ -133,3 +152,15 @@ class PciId:
     domain: int  # domain id
     bus: int  # bus id
     dev: int  # device id
+
+
+@dataclass
+class DeviceLocality:
+    """Locality of a GPU, returned by the `get_all_devices` functions of the
+    interoperability modules."""
+
+    index: int  # device ordinal
+    cpuset: Bitmap  # CPUs close to the device
+    nodeset: Bitmap  # NUMA nodes close to the device
+    pci_id: PciId
+    osdev: OsDevice | None  # None if the OS device is not in the topology
@@ -0,0 +1,248 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+"""
+Restricted Views
+================
+
+Queries restricted to a cpuset without modifying or duplicating the topology, see
+:py:meth:`~pyhwloc.topology.Topology.view`. Unlike
+:py:meth:`~pyhwloc.topology.Topology.restrict`, a view only holds a cpuset, many views
+can share the same topology.
+
+.. code-block::
+
+    with Topology() as topo:
+        tenant = topo.view({0, 1, 2, 3})
+        n_cores = tenant.n_cores()
+        for core in tenant.iter_cores():
+            print(core)
+
+"""
+
+from __future__ import annotations
+
+import weakref
+from array import array
+from copy import copy
+from dataclasses import dataclass
+from typing import TYPE_CHECKING, Iterator, cast
+
+from .bitmap import Bitmap
+from .hwloc import core as _core
+from .hwobject import NumaNode, Object, ObjType, _object
+from .utils import _Flags, _matrix_view, _or_flags, _TopoRefMixin
+
+if TYPE_CHECKING:
+    from .topology import Topology
+
+__all__ = ["TopologyView", "ViewDistances"]
+
+
+@dataclass(frozen=True)
+class ViewDistances:
+    """A distance matrix restricted to the objects inside a view, see
+    :py:meth:`TopologyView.get_distances`. The values are copied from the topology."""
+
+    name: str | None
+    """Name of the original matrix."""
+    kind: int
+    """Kind of the distances, see :py:class:`~pyhwloc.topology.DistancesKind`."""
+    objects: list[Object]
+    """Objects inside the view, in the order of the original matrix."""
+    values: memoryview
+    """Read-only, 2-dimensional view of uint64 values indexed by the positions in
+    :py:attr:`objects`."""
+
+
+class TopologyView(_TopoRefMixin):
+    """A read-only view of a topology restricted to a cpuset. Objects are included if
+    their cpuset is not empty and included in the cpuset of the view, as done by the
+    ``*_inside_cpuset_*`` functions of hwloc. Hence, CPU-less NUMA nodes and I/O
+    objects are never part of a view. Logical indices in a view are the positions of
+    the objects among the included objects of the same depth.
+
+    Parameters
+    ----------
+    topology :
+        A loaded topology.
+    cpuset :
+        The CPUs of the view. A :py:class:`set` of CPU indices is accepted as well.
+
+    """
+
+    def __init__(self, topology: Topology, cpuset: Bitmap | set[int]) -> None:
+        self._topo_ref = weakref.ref(topology)
+        if isinstance(cpuset, set):
+            self._cpuset = Bitmap.from_sched_set(cpuset)
+        else:
+            self._cpuset = copy(cpuset)
+
+    @property
+    def cpuset(self) -> Bitmap:
+        """The CPUs of the view."""
+        return copy(self._cpuset)
+
+    @property
+    def nodeset(self) -> Bitmap:
+        """NUMA nodes local to the CPUs of the view, see
+        :py:func:`~pyhwloc.hwloc.core.cpuset_to_nodeset`."""
+        nodeset = Bitmap()
+        _core.cpuset_to_nodeset(
+            self._topo.native_handle,
+            self._cpuset.native_handle,
+            nodeset.native_handle,
+        )
+        return nodeset
+
+    def __contains__(self, obj: Object) -> bool:
+        cpuset = obj.cpuset
+        return (
+            cpuset is not None
+            and not cpuset.is_zero()
+            and cpuset.is_included(self._cpuset)
+        )
+
+    def get_nbobjs_by_depth(self, depth: int) -> int:
+        """See :py:func:`~pyhwloc.hwloc.core.get_nbobjs_inside_cpuset_by_depth`."""
+        return _core.get_nbobjs_inside_cpuset_by_depth(
+            self._topo.native_handle, self._cpuset.native_handle, depth
+        )
+
+    def get_nbobjs_by_type(self, obj_type: ObjType) -> int:
+        """See :py:func:`~pyhwloc.hwloc.core.get_nbobjs_inside_cpuset_by_type`.
+
+        Returns
+        -------
+        The number of objects, -1 if there are several depths with objects of that type.
+        """
+        return _core.get_nbobjs_inside_cpuset_by_type(
+            self._topo.native_handle, self._cpuset.native_handle, obj_type
+        )
+
+    def get_obj_by_depth(self, depth: int, idx: int) -> Object | None:
+        """See :py:func:`~pyhwloc.hwloc.core.get_obj_inside_cpuset_by_depth`."""
+        ptr = _core.get_obj_inside_cpuset_by_depth(
+            self._topo.native_handle, self._cpuset.native_handle, depth, idx
+        )
+        return _object(ptr, self._topo_ref) if ptr else None
+
+    def get_obj_by_type(self, obj_type: ObjType, idx: int) -> Object | None:
+        """See :py:func:`~pyhwloc.hwloc.core.get_obj_inside_cpuset_by_type`."""
+        ptr = _core.get_obj_inside_cpuset_by_type(
+            self._topo.native_handle, self._cpuset.native_handle, obj_type, idx
+        )
+        return _object(ptr, self._topo_ref) if ptr else None
+
+    def get_obj_index(self, obj: Object) -> int:
+        """Get the logical index of an object among the objects of the view at the same
+        depth, see :py:func:`~pyhwloc.hwloc.core.get_obj_index_inside_cpuset`.
+
+        Returns
+        -------
+        The index, -1 if the object is not part of the view.
+        """
+        return _core.get_obj_index_inside_cpuset(
+            self._topo.native_handle, self._cpuset.native_handle, obj.native_handle
+        )
+
+    def iter_objs_by_depth(self, depth: int) -> Iterator[Object]:
+        """Iterate over the objects of the view at a specific depth, see
+        :py:func:`~pyhwloc.hwloc.core.get_next_obj_inside_cpuset_by_depth`."""
+        hdl = self._topo.native_handle
+        prev = None
+        while True:
+            ptr = _core.get_next_obj_inside_cpuset_by_depth(
+                hdl, self._cpuset.native_handle, depth, prev
+            )
+            if ptr is None:
+                break
+            yield _object(ptr, self._topo_ref)
+            prev = ptr
+
+    def iter_objs_by_type(self, obj_type: ObjType) -> Iterator[Object]:
+        """Iterate over the objects of the view of a specific type, see
+        :py:func:`~pyhwloc.hwloc.core.get_next_obj_inside_cpuset_by_type`. Nothing is
+        returned if there are several depths with objects of that type."""
+        hdl = self._topo.native_handle
+        prev = None
+        while True:
+            ptr = _core.get_next_obj_inside_cpuset_by_type(
+                hdl, self._cpuset.native_handle, obj_type, prev
+            )
+            if ptr is None:
+                break
+            yield _object(ptr, self._topo_ref)
+            prev = ptr
+
+    def iter_cpus(self) -> Iterator[Object]:
+        """Iterate over the processing units of the view."""
+        return self.iter_objs_by_type(ObjType.PU)
+
+    def iter_cores(self) -> Iterator[Object]:
+        """Iterate over the cores of the view."""
+        return self.iter_objs_by_type(ObjType.CORE)
+
+    def iter_numa_nodes(self) -> Iterator[NumaNode]:
+        """Iterate over the NUMA nodes whose CPUs are all part of the view."""
+        return cast(Iterator[NumaNode], self.iter_objs_by_type(ObjType.NUMANODE))
+
+    def n_cpus(self) -> int:
+        """Get the number of processing units in the view."""
+        return self.get_nbobjs_by_type(ObjType.PU)
+
+    def n_cores(self) -> int:
+        """Get the number of cores in the view."""
+        return self.get_nbobjs_by_type(ObjType.CORE)
+
+    def n_numa_nodes(self) -> int:
+        """Get the number of NUMA nodes whose CPUs are all part of the view."""
+        return self.get_nbobjs_by_type(ObjType.NUMANODE)
+
+    def get_largest_objs(self) -> list[Object]:
+        """Get the largest objects that exactly cover the view, see
+        :py:func:`~pyhwloc.hwloc.core.get_largest_objs_inside_cpuset`."""
+        hdl = self._topo.native_handle
+        n = max(self._cpuset.weight(), 1)
+        objs = (_core.obj_t * n)()
+        n = _core.get_largest_objs_inside_cpuset(
+            hdl, self._cpuset.native_handle, objs, n
+        )
+        if n < 0:
+            raise ValueError("The cpuset of the view is not included in the topology.")
+        return [_object(objs[i], self._topo_ref) for i in range(n)]
+
+    def get_distances(
+        self, kind: _Flags[_core.DistancesKind] = 0
+    ) -> list[ViewDistances]:
+        """Get the distance matrices of the topology restricted to the objects of the
+        view, see :py:meth:`~pyhwloc.topology.Topology.get_distances`. Matrices without
+        any object in the view are skipped.
+
+        """
+        topo = self._topo
+        result = []
+        for dist in topo.get_distances(_or_flags(kind)):
+            try:
+                hdl = dist.native_handle.contents
+                n = dist.nbobjs
+                objects = [_object(hdl.objs[i], self._topo_ref) for i in range(n)]
+                keep = [i for i, obj in enumerate(objects) if obj in self]
+                if not keep:
+                    continue
+                values = hdl.values
+                sub = array("Q", [values[i * n + j] for i in keep for j in keep])
+                result.append(
+                    ViewDistances(
+                        dist.name,
+                        int(hdl.kind),
+                        [objects[i] for i in keep],
+                        _matrix_view(sub, len(keep), len(keep)),
+                    )
+                )
+            finally:
+                # The values are copied, no need to keep the matrix.
+                dist.release()
+        return result
+
+    def __repr__(self) -> str:
+        return f"TopologyView(cpuset={self._cpuset})"
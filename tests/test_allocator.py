@@ -0,0 +1,123 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+from __future__ import annotations
+
+import threading
+
+import pytest
+
+from pyhwloc.bitmap import Bitmap
+from pyhwloc.hwobject import ObjType
+from pyhwloc.topology import AllowFlags, Topology, TopologyFlags
+
+# Two L3 domains of 4 cores for each package, 2 PUs per core.
+DESC = "pack:2 l3:2 core:4 pu:2"
+
+
+def test_singlify_per_core() -> None:
+    with Topology.from_synthetic(DESC) as topo:
+        cpuset = Bitmap.from_sched_set({0, 1, 2, 5})
+        assert topo.singlify_per_core(cpuset).to_sched_set() == {0, 2, 5}
+        assert topo.singlify_per_core(cpuset, 1).to_sched_set() == {1}
+        # The input is not modified.
+        assert cpuset.weight() == 4
+
+
+def test_core_allocator_packing() -> None:
+    with Topology.from_synthetic(DESC) as topo:
+        allocator = topo.core_allocator()
+    assert len(allocator) == 16 and allocator.n_free == 16
+    assert allocator.unit == ObjType.CORE
+
+    a = allocator.allocate(3)
+    # Packed inside the first L3.
+    assert a.units == [0, 1, 2]
+    assert a.cpuset.to_sched_set() == set(range(6))
+    assert [c.weight() for c in a.cpusets] == [2, 2, 2]
+    # The smallest L3 with enough free cores is used.
+    b = allocator.allocate(1)
+    assert b.units == [3]
+    c = allocator.allocate(2)
+    assert c.units == [4, 5]
+
+    a.release()
+    assert a.released
+    a.release()
+    assert allocator.n_free == 16 - 3
+    # Spills over the L3 with the most free cores first.
+    d = allocator.allocate(8)
+    assert d.units == list(range(8, 16))
+    with pytest.raises(RuntimeError, match="Not enough"):
+        allocator.allocate(6)
+    assert allocator.try_allocate(6) is None
+    with pytest.raises(ValueError, match="positive"):
+        allocator.allocate(0)
+
+    for alloc in (b, c, d):
+        alloc.release()
+    assert allocator.n_free == 16
+    assert allocator.free_cpuset.weight() == 32
+
+    with allocator.allocate(4, spread=True) as e:
+        # One core from each L3.
+        assert e.units == [0, 4, 8, 12]
+    assert allocator.n_free == 16
+
+
+def test_core_allocator_smt() -> None:
+    with Topology.from_synthetic(DESC) as topo:
+        allocator = topo.core_allocator(ObjType.PU)
+    # Siblings are avoided as long as there are idle cores in the L3.
+    pus = allocator.allocate(4)
+    assert pus.cpuset.to_sched_set() == {0, 2, 4, 6}
+    pus = allocator.allocate(2)
+    assert pus.cpuset.to_sched_set() == {1, 3}
+
+    with Topology.from_synthetic(DESC) as topo:
+        allocator = topo.core_allocator(ObjType.L3CACHE)
+    # L3 domains are packed by package.
+    assert allocator.allocate(2).units == [0, 1]
+    assert allocator.allocate(1).units == [2]
+
+
+def test_core_allocator_allowed() -> None:
+    with Topology.from_synthetic(DESC).set_flags(
+        TopologyFlags.INCLUDE_DISALLOWED
+    ) as topo:
+        allowed = Bitmap.from_sched_set(set(range(1, 32)))
+        topo.allow(allowed, None, AllowFlags.CUSTOM)
+        topo.refresh()
+        allocator = topo.core_allocator()
+        assert len(allocator) == 16
+        assert allocator.cpusets[0].to_sched_set() == {1}
+
+        topo.allow(Bitmap.from_sched_set({31}), None, AllowFlags.CUSTOM)
+        topo.refresh()
+        allocator = topo.core_allocator()
+        assert len(allocator) == 1
+        _ = allocator.allocate(1)
+        with pytest.raises(RuntimeError):
+            allocator.allocate(1)
+
+
+def test_core_allocator_threads() -> None:
+    with Topology.from_synthetic(DESC) as topo:
+        allocator = topo.core_allocator(ObjType.PU)
+    results: list[set[int]] = []
+    lock = threading.Lock()
+
+    def run() -> None:
+        for _ in range(4):
+            alloc = allocator.allocate(2)
+            with lock:
+                results.append(alloc.cpuset.to_sched_set())
+
+    threads = [threading.Thread(target=run) for _ in range(4)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    # The allocations are disjoint.
+    assert len(results) == 16
+    assert set().union(*results) == set(range(32))
+    assert allocator.n_free == 0
@@ -6,7 +6,11 @@ import copy
 import ctypes
 from typing import Callable
 
+import pytest
+
 from pyhwloc.bitmap import Bitmap
+from pyhwloc.hwobject import ObjType
+from pyhwloc.topology import Topology
 
 
 def test_bitmap_constructor_empty() -> None:
@@ -138,3 +142,67 @@ def test_with_sched_set() -> None:
     bitmap = Bitmap.from_sched_set(cpuset)
     loaded = bitmap.to_sched_set()
     assert loaded == cpuset
+
+
+def test_to_array() -> None:
+    bitmap = Bitmap.from_list_string("1,33-34,64-95,2048")
+    indices = bitmap.to_array()
+    assert indices.typecode == "I"
+    expected = [1, 33, 34] + list(range(64, 96)) + [2048]
+    assert indices.tolist() == expected
+    assert list(bitmap) == expected
+    assert bitmap.to_sched_set() == set(expected)
+
+    assert len(Bitmap().to_array()) == 0
+    assert list(Bitmap()) == []
+
+    with pytest.raises(ValueError, match="infinite"):
+        Bitmap.full().to_array()
+    with pytest.raises(ValueError, match="infinite"):
+        Bitmap.full().to_sched_set()
+    with pytest.raises(ValueError, match="infinite"):
+        Bitmap.full().to_ulongs()
+
+
+def test_to_ulongs() -> None:
+    masks = [1 << 2, 1 << 3, 0, 1]
+    bitmap = Bitmap.from_ulongs(masks)
+    words = bitmap.to_ulongs()
+    assert words.typecode == "L"
+    assert words.tolist() == masks
+    assert Bitmap.from_ulongs(words) == bitmap
+
+
+def test_inplace_ops() -> None:
+    bitmap = Bitmap.from_pyseq([1, 2, 3])
+    hdl = bitmap.native_handle
+    bitmap |= Bitmap.from_pyseq([5])
+    assert str(bitmap) == "1-3,5"
+    bitmap &= Bitmap.from_pyseq([2, 3, 5, 7])
+    assert str(bitmap) == "2-3,5"
+    bitmap ^= Bitmap.from_pyseq([3, 4])
+    assert str(bitmap) == "2,4-5"
+    bitmap -= Bitmap.from_pyseq([4])
+    assert str(bitmap) == "2,5"
+    # No new bitmap is allocated.
+    assert bitmap.native_handle == hdl
+
+    assert str(Bitmap.from_pyseq([1, 2, 3]) - Bitmap.from_pyseq([2])) == "1,3"
+
+
+def test_reduce() -> None:
+    bitmaps = [Bitmap.from_pyseq([0, 1, 2]), Bitmap.from_pyseq([1, 2, 3])]
+    bitmaps.append(Bitmap.from_list_string("2,8-"))
+    assert str(Bitmap.reduce_or(bitmaps)) == "0-3,8-"
+    assert str(Bitmap.reduce_and(bitmaps)) == "2"
+    assert str(Bitmap.reduce_or(iter(bitmaps[:2]))) == "0-3"
+    # A generator of temporaries, each one is only referenced by the reduction.
+    masks = [[0, 1], [4, 5], [9]]
+    assert str(Bitmap.reduce_or(Bitmap.from_pyseq(m) for m in masks)) == "0-1,4-5,9"
+    assert Bitmap.reduce_and(Bitmap.from_pyseq(m) for m in masks).is_zero()
+    with Topology.from_synthetic("pack:2 core:2 pu:2") as topo:
+        cores = list(topo.iter_objs_by_type(ObjType.CORE))
+        assert Bitmap.reduce_or(c.cpuset for c in cores) == topo.cpuset
+
+    assert Bitmap.reduce_or([]).is_zero()
+    assert Bitmap.reduce_and([]).is_full()
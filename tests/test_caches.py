@@ -0,0 +1,70 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+from __future__ import annotations
+
+import pytest
+
+from pyhwloc.hwloc.core import ObjCacheType
+from pyhwloc.topology import Topology
+
+# Two SMT threads per core, private L1d (32KB) and L2 (1MB), one L3 (8MB) for each
+# package.
+DESC = "pack:2 l3:1(size=8388608) l2:2(size=1048576) l1d:1(size=32768) core:1 pu:2"
+
+
+def test_cache_profile() -> None:
+    with Topology.from_synthetic(DESC) as topo:
+        profile = topo.cache_profile()
+        assert profile.n_threads == 8
+        assert [lvl.level for lvl in profile.levels] == [1, 2, 3]
+        assert [lvl.level for lvl in profile.private_levels] == [1, 2]
+        assert [lvl.level for lvl in profile.shared_levels] == [3]
+
+        l1 = profile[1]
+        assert l1.cache_type == ObjCacheType.DATA
+        assert l1.size == 32 * 1024 and l1.linesize == 64
+        assert l1.n_caches == 4 and l1.capacity == 4 * 32 * 1024
+        # Shared by the SMT threads of a core.
+        assert l1.pus_per_cache == l1.threads_per_cache == 2
+        assert l1.per_thread == 16 * 1024
+
+        l3 = profile[3]
+        assert l3.n_caches == 2 and l3.threads_per_cache == 4
+        assert l3.per_thread == 2 * 1024 * 1024
+        with pytest.raises(KeyError):
+            profile[4]
+
+        # One thread per core on the first package.
+        profile = topo.cache_profile({0, 2})
+        assert profile.n_threads == 2
+        assert profile[1].per_thread == 32 * 1024
+        assert profile[1].n_caches == 2 and profile[1].pus_per_cache == 2
+        assert profile[3].n_caches == 1
+        assert profile[3].per_thread == 4 * 1024 * 1024
+
+
+def test_blocking_sizes() -> None:
+    with Topology.from_synthetic(DESC) as topo:
+        profile = topo.cache_profile({0, 2, 4, 6})
+        l1 = profile[1]
+        assert l1.block_bytes() == 16 * 1024
+        assert l1.block_bytes(1.0) == 32 * 1024
+        assert l1.block_bytes(0.3) % l1.linesize == 0
+        with pytest.raises(ValueError):
+            l1.block_bytes(0.0)
+
+        assert profile.block_size(1, 8) == 2048
+        assert profile.block_size(1, 8, n_arrays=2) == 1024
+        # 3 tiles of float32 in half of the 1MB L2.
+        side = profile.square_tile(2, 4)
+        assert side % 16 == 0
+        assert 3 * side * side * 4 <= 512 * 1024 < 3 * (side + 16) ** 2 * 4
+        with pytest.raises(ValueError):
+            profile.block_size(1, 0)
+
+
+def test_no_cache() -> None:
+    with Topology.from_synthetic("pack:2 core:2 pu:2") as topo:
+        profile = topo.cache_profile()
+        assert profile.levels == []
+        assert profile.n_threads == 8
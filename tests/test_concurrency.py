@@ -0,0 +1,78 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+from __future__ import annotations
+
+import copy
+import pickle
+import threading
+from concurrent.futures import ThreadPoolExecutor
+from typing import Any
+
+from pyhwloc.hwobject import ObjType
+from pyhwloc.topology import Topology
+
+N_THREADS = 16
+N_ROUNDS = 64
+
+
+def _query(topo: Topology) -> dict[str, Any]:
+    cores = list(topo.iter_cores())
+    index = topo.locality_index()
+    snapshot = topo.snapshot_level(topo.depth - 1)
+    view = topo.view({0, 1, 2, 3})
+    return {
+        "cores": [id(c) for c in cores],
+        "cpusets": [str(c.cpuset) for c in cores],
+        "n_cpus": topo.n_cpus(),
+        "numa": [index.lookup(ObjType.NUMANODE, pu) for pu in range(index.n_pus)],
+        "gp_index": snapshot.gp_index.tolist(),
+        "view": view.n_cores(),
+        "xml": len(topo.export_xml_buffer()),
+        "pickle": pickle.loads(pickle.dumps(topo)).n_cpus(),
+        "copy": copy.copy(topo).n_cpus(),
+    }
+
+
+def test_concurrent_queries() -> None:
+    with Topology.from_synthetic("pack:2 numa:1 l3:1 core:8 pu:2") as topo:
+        barrier = threading.Barrier(N_THREADS)
+
+        def run(i: int) -> dict[str, Any]:
+            if i < N_THREADS:
+                # Start together so that the caches are filled concurrently.
+                barrier.wait()
+            return _query(topo)
+
+        with ThreadPoolExecutor(N_THREADS) as executor:
+            results = list(executor.map(run, range(N_ROUNDS)))
+
+        expected = results[0]
+        assert expected["n_cpus"] == expected["pickle"] == expected["copy"] == 32
+        assert expected["view"] == 2
+        for result in results:
+            assert result == expected
+        # The identity map holds a single instance of each object.
+        assert [id(c) for c in topo.iter_cores()] == expected["cores"]
+
+
+def test_concurrent_load() -> None:
+    def load(i: int) -> int:
+        with Topology.from_synthetic(f"pack:{i % 4 + 1} core:2 pu:2") as topo:
+            return topo.n_cpus()
+
+    with ThreadPoolExecutor(N_THREADS) as executor:
+        counts = list(executor.map(load, range(N_ROUNDS)))
+    assert counts == [(i % 4 + 1) * 4 for i in range(N_ROUNDS)]
+
+
+def test_concurrent_distances() -> None:
+    with Topology() as topo:
+
+        def run(_: int) -> int:
+            return len(topo.get_distances())
+
+        with ThreadPoolExecutor(N_THREADS) as executor:
+            counts = list(executor.map(run, range(N_ROUNDS)))
+        assert len(set(counts)) == 1
+    # All matrices are released along with the topology.
+    assert topo._cleanup == []
@@ -5,7 +5,7 @@ from __future__ import annotations
 import pytest
 
 from pyhwloc.bitmap import Bitmap
-from pyhwloc.topology import Topology
+from pyhwloc.topology import AllowFlags, Topology, TopologyFlags
 
 
 def test_cpukinds() -> None:
@@ -48,3 +48,42 @@ def test_cpukinds() -> None:
 
         kind_idx = kinds.get_kind_by_cpuset(retrieved_cpuset)
         assert kind_idx == 0
+
+
+def test_cpukinds_partition() -> None:
+    with Topology.from_synthetic("pack:2 core:2 pu:2").set_flags(
+        TopologyFlags.INCLUDE_DISALLOWED
+    ) as topo:
+        kinds = topo.get_cpukinds()
+        # No CPU kind information, a single kind covers all CPUs.
+        (kind,) = kinds.partition()
+        assert kind.rank == 0 and kind.index == -1 and kind.efficiency == -1
+        assert kind.cpuset == topo.allowed_cpuset
+        assert kind.core_type is None and kind.frequency_max_mhz is None
+
+        little = {"CoreType": "IntelAtom", "FrequencyMaxMHz": "2800"}
+        big = {"CoreType": "IntelCore", "FrequencyMaxMHz": "4600"}
+        kinds.register(Bitmap.from_sched_set({0, 1, 2, 3}), 0, infos=little)
+        kinds.register(Bitmap.from_sched_set({4, 5, 6, 7}), 1, infos=big)
+
+        fast, slow = kinds.partition()
+        assert (fast.rank, slow.rank) == (0, 1)
+        assert fast.core_type == "IntelCore" and fast.frequency_max_mhz == 4600
+        assert slow.core_type == "IntelAtom" and slow.frequency_max_mhz == 2800
+        assert fast.cpuset.to_sched_set() == {4, 5, 6, 7}
+        assert fast.efficiency > slow.efficiency
+        assert kinds.get_info(fast.index)[0] == fast.cpuset
+
+        # Kinds are limited to the allowed CPUs.
+        topo.allow(Bitmap.from_sched_set({0, 1, 2, 3}), None, AllowFlags.CUSTOM)
+        topo.refresh()
+        (kind,) = kinds.partition()
+        assert kind.core_type == "IntelAtom"
+        assert len(kinds.partition(allowed=False)) == 2
+
+        plan = topo.distribute(2, kind=0)
+        assert [c.to_sched_set() for c in plan.cpusets] == [{0, 1}, {2, 3}]
+        with pytest.raises(IndexError):
+            topo.distribute(2, kind=1)
+        with pytest.raises(ValueError, match="exclusive"):
+            topo.distribute(2, roots=[topo.get_root_obj()], kind=0)
@@ -44,3 +44,24 @@ def test_cuda_driver() -> None:
 
         with pytest.raises(RuntimeError, match="get_device"):
             type(dev)()
+
+
+def test_get_all_devices() -> None:
+    with Topology.from_this_system().set_io_types_filter(TypeFilter.KEEP_ALL) as topo:
+        cuda.cuInit(0)
+        status, n = cuda.cuDeviceGetCount()
+        _check_cu(status)
+
+        table = hwloc_cudadr.get_all_devices(topo)
+        assert len(table) == n
+        for i, loc in enumerate(table):
+            dev = hwloc_cudadr.get_device(topo, i)
+            assert loc.index == i
+            assert loc.cpuset == dev.get_affinity()
+            assert loc.pci_id == dev.pci_id
+            assert loc.osdev == dev.get_osdev()
+            assert not loc.nodeset.is_zero()
+
+        # Cached, but the bitmaps are copies.
+        table[0].cpuset.zero()
+        assert not hwloc_cudadr.get_all_devices(topo)[0].cpuset.is_zero()
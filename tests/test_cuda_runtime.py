@@ -33,3 +33,24 @@ def test_cudart() -> None:
 
         with pytest.raises(RuntimeError, match="get_device"):
             type(dev)()
+
+
+def test_get_all_devices() -> None:
+    import cuda.bindings.runtime as cudart
+
+    with Topology.from_this_system().set_io_types_filter(TypeFilter.KEEP_ALL) as topo:
+        status, n = cudart.cudaGetDeviceCount()
+        assert status == cudart.cudaError_t.cudaSuccess
+
+        table = hwloc_cudart.get_all_devices(topo)
+        assert len(table) == n
+        for i, loc in enumerate(table):
+            dev = hwloc_cudart.get_device(topo, i)
+            assert loc.index == i
+            assert loc.cpuset == dev.get_affinity()
+            assert loc.pci_id == dev.pci_id
+            assert loc.osdev == dev.get_osdev()
+
+        # Cached, but the bitmaps are copies.
+        table[0].cpuset.zero()
+        assert not hwloc_cudart.get_all_devices(topo)[0].cpuset.is_zero()
@@ -0,0 +1,83 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+from __future__ import annotations
+
+import os
+import tempfile
+
+import pytest
+
+from pyhwloc.diff import TopologyDiff, TopologyDiffObjAttrType, TopologyDiffType
+from pyhwloc.hwloc.lib import HwLocError
+from pyhwloc.hwobject import ObjType
+from pyhwloc.topology import Topology
+
+
+def test_topology_diff() -> None:
+    desc = "pack:2 numa:1(memory=1GB) pu:2"
+    new_desc = desc.replace("1GB", "2GB")
+    with Topology.from_synthetic(desc) as old, Topology.from_synthetic(new_desc) as new:
+        with old.diff(old) as diff:
+            assert len(diff) == 0
+            assert not diff.is_too_complex
+            assert diff.native_handle is None
+
+        node = next(old.iter_numa_nodes())
+        assert node.total_memory == 1000000000
+
+        diff = old.diff(new)
+        assert not diff.is_too_complex
+        sizes = [e for e in diff if e.attr_type == TopologyDiffObjAttrType.SIZE]
+        assert len(sizes) == 2
+        for entry in sizes:
+            assert entry.type == TopologyDiffType.OBJ_ATTR
+            assert entry.oldvalue == 1000000000
+            assert entry.newvalue == 2000000000
+            obj = old.get_obj_by_depth(entry.obj_depth, entry.obj_index)
+            assert obj is not None and obj.type == ObjType.NUMANODE
+        # The synthetic description is an info attribute of the root.
+        (info,) = [e for e in diff if e.attr_type == TopologyDiffObjAttrType.INFO]
+        assert info.name == "SyntheticDescription"
+        assert (info.oldvalue, info.newvalue) == (desc, new_desc)
+
+        # Objects are updated in place.
+        diff.apply(old)
+        assert node.total_memory == 2000000000
+        assert next(old.iter_numa_nodes()) is node
+        assert len(old.diff(new)) == 0
+        diff.apply(old, reverse=True)
+        assert node.total_memory == 1000000000
+        # Cannot be applied twice in the reverse direction.
+        with pytest.raises((ValueError, HwLocError)):
+            diff.apply(old, reverse=True)
+        assert node.total_memory == 1000000000
+
+        xml = diff.export_xml_buffer("old.xml")
+        with TopologyDiff.from_xml_buffer(xml) as loaded:
+            assert loaded.refname == "old.xml"
+            assert loaded.entries == diff.entries
+        with tempfile.TemporaryDirectory() as tmpdir:
+            path = os.path.join(tmpdir, "diff.xml")
+            diff.export_xml_file(path)
+            with TopologyDiff.from_xml_file(path) as loaded:
+                assert loaded.refname is None
+                assert loaded.entries == diff.entries
+
+        diff.destroy()
+        with pytest.raises(RuntimeError, match="destroyed"):
+            diff.apply(old)
+        # No-op
+        diff.destroy()
+
+    old = Topology.from_synthetic("pack:2 pu:2", load=True)
+    new = Topology.from_synthetic("pack:2 pu:4", load=True)
+    with old, new:
+        with old.diff(new) as diff:
+            assert diff.is_too_complex
+            (entry,) = diff.entries
+            assert entry.type == TopologyDiffType.TOO_COMPLEX
+            assert entry.attr_type is None
+            with pytest.raises(ValueError, match="complex"):
+                diff.apply(old)
+            with pytest.raises(ValueError):
+                diff.export_xml_buffer()
@@ -3,6 +3,7 @@
 from __future__ import annotations
 
 import os
+import pickle
 
 import pytest
 
@@ -93,3 +94,37 @@ def test_distance_error_handling() -> None:
     distances = topo.get_distances()
     assert len(topo._cleanup) == 2
     assert topo._cleanup[0]() is None
+
+
+def test_distance_as_array() -> None:
+    with Topology.from_xml_file(xml_path=sample_numa_path) as topo:
+        dist = topo.get_distances()[0]
+        values = dist.as_array()
+        assert values.readonly
+        assert values.shape == dist.shape
+        assert values.format == "Q"
+        assert values.tolist() == [[10, 21], [21, 10]]
+        for i in range(dist.nbobjs):
+            for j in range(dist.nbobjs):
+                assert values[i, j] == dist[i, j]
+
+        with pytest.raises(TypeError):
+            values[0, 0] = 1
+
+        # Buffer protocol
+        assert memoryview(dist).tolist() == values.tolist()
+
+    # Views are released along with the topology.
+    with pytest.raises(ValueError, match="released"):
+        _ = values[0, 0]
+
+    topo = Topology.from_xml_file(xml_path=sample_numa_path).load()
+    dist = topo.get_distances()[0]
+    # Simulate a consumer like a NumPy array holding the buffer.
+    consumer = pickle.PickleBuffer(dist.as_array())
+    with pytest.raises(RuntimeError, match="exported"):
+        topo.destroy()
+    assert topo.is_loaded
+    consumer.release()
+    topo.destroy()
+    assert not topo.is_loaded
@@ -0,0 +1,159 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+from __future__ import annotations
+
+import gc
+import threading
+
+import pytest
+
+from pyhwloc import Topology
+from pyhwloc.bitmap import Bitmap
+from pyhwloc.executor import TopologyExecutor
+from pyhwloc.hwobject import ObjType
+
+
+def test_executor_binding() -> None:
+    with Topology() as topo:
+        executor = TopologyExecutor(topo, ObjType.CORE, work_stealing=False)
+        domains = executor.domains
+        assert len(domains) == topo.n_cores()
+        assert executor.n_workers == len(domains)
+
+    # The topology has been destroyed, workers keep running.
+    with executor:
+        for i, cpuset in enumerate(domains):
+
+            def get_binding() -> set[int]:
+                with Topology() as topo:
+                    return topo.get_thread_cpubind(threading.get_ident()).to_sched_set()
+
+            binding = executor.submit_to(i, get_binding).result()
+            assert binding == cpuset.to_sched_set()
+
+        results = list(executor.map(lambda x: x * 2, range(64)))
+        assert results == [x * 2 for x in range(64)]
+
+    with pytest.raises(RuntimeError, match="shutdown"):
+        executor.submit(sum, [1, 2])
+    assert executor.unbound_domains == []
+
+
+def test_executor_binding_failure() -> None:
+    def fail(thread_id: int, target: Bitmap) -> None:
+        raise OSError("Not permitted")
+
+    with Topology.from_synthetic("pack:2 core:2 pu:2") as topo:
+        topo.set_thread_cpubind = fail  # type: ignore[method-assign]
+        with pytest.raises(OSError, match="permitted"):
+            TopologyExecutor(topo, ObjType.PACKAGE)
+        executor = TopologyExecutor(topo, ObjType.PACKAGE, strict_binding=False)
+    with executor:
+        assert executor.unbound_domains == [0, 1]
+        assert executor.submit(sum, [1, 2]).result() == 3
+
+
+def test_executor_finalize() -> None:
+    with Topology() as topo:
+        executor = TopologyExecutor(topo, ObjType.MACHINE, workers_per_domain=2)
+    threads = list(executor._threads)
+    assert executor.submit(sum, [1, 2]).result() == 3
+    # Workers don't keep the executor alive, they are stopped when it's collected.
+    del executor
+    gc.collect()
+    for t in threads:
+        t.join(timeout=10)
+        assert not t.is_alive()
+
+
+def test_executor_work_stealing() -> None:
+    with Topology() as topo:
+        executor = TopologyExecutor(topo, ObjType.MACHINE, workers_per_domain=2)
+    assert len(executor.domains) == 1
+    assert executor.n_workers == 2
+
+    with executor:
+        barrier = threading.Barrier(2, timeout=10)
+        # Both workers of the domain need to run concurrently to pass the barrier.
+        futures = [executor.submit_to(0, barrier.wait) for _ in range(2)]
+        assert sorted(f.result() for f in futures) == [0, 1]
+
+        with pytest.raises(IndexError):
+            executor.submit_to(1, sum, [1])
+
+        def fail() -> None:
+            raise ValueError("Foo")
+
+        with pytest.raises(ValueError, match="Foo"):
+            executor.submit(fail).result()
+
+    with Topology.from_synthetic("pack:2 core:2 pu:2") as topo:
+        # Synthetic topology is not this system, binding is a no-op.
+        executor = TopologyExecutor(topo, ObjType.PACKAGE)
+        try:
+            assert len(executor.domains) == 2
+            # Stealing prefers domains sharing a package.
+            assert executor._steal_order[0] == [1]
+        finally:
+            executor.shutdown()
+
+    with Topology.from_synthetic("pack:2 core:2 pu:2") as topo:
+        executor = TopologyExecutor(topo, ObjType.CORE)
+        try:
+            assert executor._steal_order[0] == [1, 2, 3]
+            assert executor._steal_order[2] == [3, 0, 1]
+            # A task queued for a domain can be stolen.
+            assert executor.submit_to(3, sum, [1, 2]).result() == 3
+        finally:
+            executor.shutdown()
+
+
+def test_executor_cpu_kinds() -> None:
+    with Topology.from_synthetic("pack:2 core:2 pu:2") as topo:
+        kinds = topo.get_cpukinds()
+        kinds.register(Bitmap.from_sched_set({0, 1, 2, 3}), 0, {"CoreType": "E"})
+        kinds.register(Bitmap.from_sched_set({4, 5, 6, 7}), 1, {"CoreType": "P"})
+        executor = TopologyExecutor(topo, ObjType.CORE)
+        machine = TopologyExecutor(topo, ObjType.MACHINE)
+    try:
+        assert [k.core_type for k in executor.kinds] == ["P", "E"]
+        assert executor.domains_of_kind(0) == [2, 3]
+        assert executor.domains_of_kind(1) == [0, 1]
+
+        def name() -> str:
+            return threading.current_thread().name
+
+        # Tasks of a kind are not stolen by the workers of another kind.
+        futures = [executor.submit_to_kind(0, name) for _ in range(64)]
+        names = {f.result() for f in futures}
+        assert names <= {"pyhwloc-core-2", "pyhwloc-core-3"}
+        futures = [executor.submit_to_kind(1, name) for _ in range(64)]
+        assert {f.result() for f in futures} <= {"pyhwloc-core-0", "pyhwloc-core-1"}
+
+        # Tasks of a kind queued behind plain tasks don't prevent stealing them.
+        started = threading.Semaphore(0)
+        event = threading.Event()
+
+        def block() -> None:
+            started.release()
+            event.wait(10)
+
+        blockers = [executor.submit_to_kind(0, block) for _ in range(2)]
+        for _ in blockers:
+            assert started.acquire(timeout=10)
+        try:
+            plain = [executor.submit_to(2, name) for _ in range(4)]
+            bound = [executor.submit_to_kind(0, name) for _ in range(2)]
+            names = {f.result(timeout=10) for f in plain}
+            assert names <= {"pyhwloc-core-0", "pyhwloc-core-1"}
+        finally:
+            event.set()
+        assert {f.result() for f in bound} <= {"pyhwloc-core-2", "pyhwloc-core-3"}
+
+        # The machine spans both kinds.
+        assert machine.domains_of_kind(0) == []
+        with pytest.raises(ValueError, match="kind"):
+            machine.submit_to_kind(0, name)
+    finally:
+        executor.shutdown()
+        machine.shutdown()
@@ -40,6 +40,7 @@ from pyhwloc.hwloc.bitmap import (
     bitmap_sscanf,
     bitmap_taskset_snprintf,
     bitmap_taskset_sscanf,
+    bitmap_to_indices,
     bitmap_to_ulong,
     bitmap_weight,
     bitmap_xor,
@@ -177,6 +178,16 @@ def test_bitmap_iteration() -> None:
         bit = bitmap_next(bitmap, bit)
     assert bits == [1, 5, 8, 12]
 
+    # Bulk export
+    assert bitmap_to_indices(bitmap, None, 0) == 4
+    indices = (ctypes.c_uint * 4)()
+    assert bitmap_to_indices(bitmap, indices, 4) == 4
+    assert list(indices) == [1, 5, 8, 12]
+    # Truncated
+    indices = (ctypes.c_uint * 4)()
+    assert bitmap_to_indices(bitmap, indices, 2) == 4
+    assert list(indices) == [1, 5, 0, 0]
+
     bitmap_free(bitmap)
 
 
@@ -25,6 +25,9 @@ from pyhwloc.hwloc.core import (
     ObjAttr,
     ObjType,
     TopologyComponentsFlag,
+    TopologyDiffApplyFlags,
+    TopologyDiffObjAttrType,
+    TopologyDiffType,
     TopologyFlags,
     TypeFilter,
     bridge_covers_pcibus,
@@ -66,6 +69,11 @@ from pyhwloc.hwloc.core import (
     topology_abi_check,
     topology_check,
     topology_destroy,
+    topology_diff_apply,
+    topology_diff_build,
+    topology_diff_destroy,
+    topology_diff_export_xmlbuffer,
+    topology_diff_load_xmlbuffer,
     topology_dup,
     topology_export_synthetic,
     topology_export_xmlbuffer,
@@ -85,6 +93,7 @@ from pyhwloc.hwloc.core import (
     topology_set_components,
     topology_set_flags,
     topology_set_io_types_filter,
+    topology_set_synthetic,
     topology_set_xmlbuffer,
     topology_t,
     type_sscanf,
@@ -1001,3 +1010,57 @@ def test_get_next_child_is_in_subtree() -> None:
     first_child = get_next_child(topo.hdl, root_obj, None)
     assert first_child is not None
     assert is_same_obj(first_child.contents.parent, root_obj)
+
+
+######################
+# Topology differences
+######################
+
+
+def test_topology_diff() -> None:
+    def load(desc: str) -> topology_t:
+        hdl = topology_t()
+        topology_init(hdl)
+        topology_set_synthetic(hdl, desc)
+        topology_load(hdl)
+        return hdl
+
+    old = load("node:2(memory=1GB) pu:2")
+    new = load("node:2(memory=2GB) pu:2")
+    other = load("node:2 pu:4")
+
+    assert topology_diff_build(old, old) is None
+
+    diff = topology_diff_build(old, new)
+    assert diff is not None
+    sizes = []
+    ptr = diff
+    while ptr:
+        if ptr.contents.generic.type == TopologyDiffType.OBJ_ATTR:
+            attr = ptr.contents.obj_attr.diff
+            if attr.generic.type == TopologyDiffObjAttrType.SIZE:
+                sizes.append((attr.uint64.oldvalue, attr.uint64.newvalue))
+        ptr = ptr.contents.generic.next
+    assert sizes == [(1000000000, 2000000000)] * 2
+
+    topology_diff_apply(old, diff, 0)
+    assert topology_diff_build(old, new) is None
+    topology_diff_apply(old, diff, TopologyDiffApplyFlags.REVERSE)
+
+    buf = topology_diff_export_xmlbuffer(diff, "ref")
+    loaded, refname = topology_diff_load_xmlbuffer(buf)
+    assert loaded is not None
+    assert refname == "ref"
+    assert topology_diff_export_xmlbuffer(loaded, "ref") == buf
+    topology_diff_destroy(loaded)
+    topology_diff_destroy(diff)
+
+    diff = topology_diff_build(old, other)
+    assert diff is not None
+    assert diff.contents.generic.type == TopologyDiffType.TOO_COMPLEX
+    with pytest.raises(ValueError):
+        topology_diff_apply(old, diff, 0)
+    topology_diff_destroy(diff)
+
+    for hdl in (old, new, other):
+        topology_destroy(hdl)
@@ -0,0 +1,122 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+from __future__ import annotations
+
+import ctypes
+from contextlib import contextmanager
+from typing import Iterator
+
+import pytest
+
+from pyhwloc.hwloc import bitmap as _bitmap
+from pyhwloc.hwloc import core as _core
+from pyhwloc.hwloc.lib import _LIB, _fastpath, _pyhwloc_lib
+
+pytestmark = pytest.mark.skipif(
+    _fastpath is None, reason="The native fast path is not built."
+)
+
+
+@contextmanager
+def _synthetic() -> Iterator[_core.topology_t]:
+    hdl = _core.topology_t()
+    _core.topology_init(hdl)
+    _core.topology_set_synthetic(hdl, "pack:2 numa:2 core:3 pu:2")
+    _core.topology_load(hdl)
+    try:
+        yield hdl
+    finally:
+        _core.topology_destroy(hdl)
+
+
+def _same(a: ctypes._Pointer | None, b: ctypes._Pointer) -> bool:
+    if a is None:
+        return not b
+    return _core.is_same_obj(a, b)
+
+
+def test_rebound() -> None:
+    assert _core.get_obj_by_depth is _fastpath.get_obj_by_depth
+    assert _bitmap.bitmap_next is _fastpath.bitmap_next
+
+
+def test_levels() -> None:
+    with _synthetic() as hdl:
+        _check_levels(hdl)
+
+
+def _check_levels(hdl: _core.topology_t) -> None:
+    ObjType = _core.ObjType
+    for obj_type in (ObjType.PACKAGE, ObjType.NUMANODE, ObjType.CORE, ObjType.PU):
+        depth = _core.get_type_depth(hdl, obj_type)
+        assert depth == _LIB.hwloc_get_type_depth(hdl, obj_type)
+        n = _core.get_nbobjs_by_type(hdl, obj_type)
+        assert n == _pyhwloc_lib.pyhwloc_get_nbobjs_by_type(hdl, obj_type)
+        assert n == _core.get_nbobjs_by_depth(hdl, depth)
+
+        prev = None
+        for i in range(n):
+            obj = _core.get_obj_by_type(hdl, obj_type, i)
+            assert obj is not None
+            assert isinstance(obj, _core.obj_t)
+            assert obj.contents.logical_index == i
+            assert _same(obj, _LIB.hwloc_get_obj_by_depth(hdl, depth, i))
+            prev = _core.get_next_obj_by_type(hdl, obj_type, prev)
+            assert _same(prev, obj)
+        assert _core.get_obj_by_type(hdl, obj_type, n) is None
+        assert _core.get_obj_by_depth(hdl, depth, n) is None
+        assert _core.get_next_obj_by_depth(hdl, depth, prev) is None
+
+    root = _core.get_root_obj(hdl)
+    assert _same(root, _pyhwloc_lib.pyhwloc_get_root_obj(hdl))
+    pu = _core.get_pu_obj_by_os_index(hdl, 3)
+    assert pu is not None and pu.contents.os_index == 3
+    node = _core.get_numanode_obj_by_os_index(hdl, 1)
+    assert node is not None and node.contents.os_index == 1
+    assert _core.get_pu_obj_by_os_index(hdl, 1 << 20) is None
+
+    pkg = _core.get_ancestor_obj_by_type(hdl, ObjType.PACKAGE, pu)
+    assert _same(pkg, _core.get_obj_by_type(hdl, ObjType.PACKAGE, 0))
+    assert _same(_core.get_ancestor_obj_by_depth(hdl, 0, pu), root)
+    assert _core.get_ancestor_obj_by_depth(hdl, 1, root) is None
+
+
+def test_bitmap() -> None:
+    a = _bitmap.bitmap_alloc()
+    b = _bitmap.bitmap_alloc()
+    try:
+        assert _bitmap.bitmap_iszero(a) is True
+        assert _bitmap.bitmap_first(a) == -1
+        _bitmap.bitmap_set_range(a, 2, 9)
+        _bitmap.bitmap_set(b, 4)
+        assert _bitmap.bitmap_iszero(a) is False
+        assert _bitmap.bitmap_weight(a) == _LIB.hwloc_bitmap_weight(a) == 8
+        assert _bitmap.bitmap_isset(a, 2) is True
+        assert _bitmap.bitmap_isset(a, 1) is False
+        assert (_bitmap.bitmap_first(a), _bitmap.bitmap_last(a)) == (2, 9)
+
+        indices = []
+        i = _bitmap.bitmap_first(a)
+        while i != -1:
+            indices.append(i)
+            i = _bitmap.bitmap_next(a, i)
+        assert indices == list(range(2, 10))
+
+        assert _bitmap.bitmap_intersects(a, b) is True
+        assert _bitmap.bitmap_isincluded(b, a) is True
+        assert _bitmap.bitmap_isincluded(a, b) is False
+        assert _bitmap.bitmap_isequal(a, b) is False
+        assert _bitmap.bitmap_isequal(a, a.value) is True
+    finally:
+        _bitmap.bitmap_free(a)
+        _bitmap.bitmap_free(b)
+
+
+def test_errors() -> None:
+    with _synthetic() as hdl:
+        with pytest.raises(TypeError):
+            _core.get_type_depth(hdl)  # type: ignore[call-arg]
+        with pytest.raises(TypeError):
+            _core.get_obj_by_depth(hdl, "0", 0)  # type: ignore[arg-type]
+    with pytest.raises(TypeError):
+        _bitmap.bitmap_weight("bitmap")  # type: ignore[arg-type]
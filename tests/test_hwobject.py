@@ -42,6 +42,40 @@ def test_invalid_topo() -> None:
         _ = root.type
 
 
+def test_identity_map() -> None:
+    with Topology.from_synthetic("node:2 core:2 pu:2") as topo:
+        root = topo.get_root_obj()
+        assert root is topo.get_obj_by_depth(0, 0)
+        pu = topo.get_obj_by_type(ObjType.PU, 3)
+        assert pu is not None
+        assert pu is list(topo.iter_cpus())[3]
+        assert pu.parent is not None and pu.parent.parent is root.children[0]
+
+        # Memoized mutable fields are copies.
+        cpuset = pu.cpuset
+        assert cpuset is not None
+        cpuset.set(7)
+        assert pu.cpuset is not None and pu.cpuset.weight() == 1
+        info = root.info
+        info["foo"] = "bar"
+        assert "foo" not in root.info
+
+        # Only the attributes are modified, objects are kept.
+        root.add_info("Key", "Value")
+        assert root.info["Key"] == "Value"
+        assert topo.get_root_obj() is root
+        assert topo.get_obj_by_type(ObjType.PU, 3) is pu
+
+        # Restricting resets both the identity map and the memos.
+        topo.restrict(topo.get_obj_by_type(ObjType.PU, 0).cpuset, 0)  # type: ignore
+        assert root.cpuset is not None and root.cpuset.weight() == 1
+        assert topo.get_root_obj() is not root
+        assert topo.get_root_obj() == root
+
+    with pytest.raises(RuntimeError, match="Topology is invalid"):
+        _ = pu.cpuset
+
+
 def test_object_properties() -> None:
     with Topology.from_synthetic("node:2 core:2 pu:4") as topo:
         # Get a CPU object to test properties
@@ -0,0 +1,78 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+from __future__ import annotations
+
+import threading
+
+import pyhwloc
+from pyhwloc import Topology, instrument
+from pyhwloc.hwloc import core as _core
+from pyhwloc.hwloc import lib as _lib
+
+
+def test_instrument() -> None:
+    # Enabled by the environment.
+    was_enabled = instrument.is_enabled()
+    instrument.disable()
+    original = _core.set_cpubind
+    ffi = _lib._LIB.hwloc_set_cpubind
+    instrument.reset()
+    with Topology() as topo:
+        cpuset = topo.get_cpubind()
+        topo.set_cpubind(cpuset)
+        assert not instrument.is_enabled()
+        assert instrument.stats() == {}
+
+        with instrument.instrumented():
+            assert instrument.is_enabled()
+            assert _core.set_cpubind is not original
+            wrapped = _core.set_cpubind.__wrapped__  # type: ignore[attr-defined]
+            assert wrapped is original
+            for _ in range(3):
+                topo.set_cpubind(cpuset)
+            threads = [
+                threading.Thread(target=topo.set_cpubind, args=(cpuset,))
+                for _ in range(4)
+            ]
+            for t in threads:
+                t.start()
+            for t in threads:
+                t.join()
+            # No-op
+            instrument.enable()
+
+        # The original functions are restored.
+        assert not instrument.is_enabled()
+        assert _core.set_cpubind is original
+        assert _lib._LIB.hwloc_set_cpubind is ffi
+        topo.set_cpubind(cpuset)
+
+    stats = pyhwloc.stats()
+    assert stats == instrument.stats()
+    py = stats["core.set_cpubind"]
+    assert py.layer == "python"
+    assert py.count == 7
+    assert sum(py.buckets) == 7
+    c = stats["hwloc_set_cpubind"]
+    assert c.layer == "ffi"
+    assert c.count == 7
+    assert 0 < c.total_ns <= py.total_ns
+    assert c.mean_ns == c.total_ns / 7
+    totals = [s.total_ns for s in stats.values()]
+    assert totals == sorted(totals, reverse=True)
+
+    text = instrument.to_prometheus()
+    assert "# TYPE pyhwloc_call_duration_seconds histogram" in text
+    assert (
+        'pyhwloc_call_duration_seconds_bucket{function="hwloc_set_cpubind",'
+        'layer="ffi",le="+Inf"} 7'
+    ) in text
+    assert (
+        'pyhwloc_call_duration_seconds_count{function="core.set_cpubind",'
+        'layer="python"} 7'
+    ) in text
+
+    instrument.reset()
+    assert instrument.stats() == {}
+    if was_enabled:
+        instrument.enable()
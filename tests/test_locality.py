@@ -0,0 +1,103 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+from __future__ import annotations
+
+import os
+
+import pytest
+
+from pyhwloc.hwloc.lib import normpath
+from pyhwloc.hwobject import ObjOsdevType, ObjType, OsDevice
+from pyhwloc.locality import IoPathKind
+from pyhwloc.topology import Topology, TypeFilter
+
+
+def test_locality_index() -> None:
+    with Topology.from_synthetic("pack:2 numa:1 l3:1 core:2 pu:2") as topo:
+        index = topo.locality_index()
+        assert index is topo.locality_index()
+        assert index.n_pus == topo.n_cpus() == 8
+
+        for pu in topo.iter_cpus():
+            for typ in [ObjType.CORE, ObjType.L3CACHE, ObjType.PACKAGE]:
+                ancestor = pu.get_ancestor_obj_by_type(typ)
+                assert ancestor is not None
+                assert index.lookup(typ, pu.os_index) == ancestor.logical_index
+            assert index.lookup(ObjType.NUMANODE, pu.os_index) == pu.os_index // 4
+        # No L2 in the synthetic topology.
+        assert list(index.table(ObjType.L2CACHE)) == [-1] * 8
+        assert index.lookup(ObjType.CORE, 8) == -1
+        assert index.lookup(ObjType.CORE, -1) == -1
+
+        table = index.table(ObjType.CORE)
+        assert table.readonly
+        assert list(table) == [0, 0, 1, 1, 2, 2, 3, 3]
+        assert index.os_devices(0) == []
+        assert index.local_os_devices(0, ObjOsdevType.GPU) == []
+
+        # Rebuilt after modification.
+        topo.restrict(topo.get_numanode_obj_by_os_index(1).cpuset, 0)  # type: ignore
+        assert topo.locality_index() is not index
+        assert topo.locality_index().lookup(ObjType.PACKAGE, 4) == 0
+
+    with pytest.raises(RuntimeError, match="Topology is invalid"):
+        index.lookup(ObjType.CORE, 0)
+
+
+def test_locality_index_os_devices() -> None:
+    path = os.path.join(os.path.dirname(normpath(__file__)), "sample_osdev.xml")
+    with Topology.from_xml_file(path).set_io_types_filter(TypeFilter.KEEP_ALL) as topo:
+        index = topo.locality_index()
+        devices = index.os_devices(0)
+        assert len(devices) == topo.n_os_devices() > 0
+        assert all(isinstance(dev, OsDevice) for dev in devices)
+        # The sample doesn't have any PU.
+        assert index.n_pus == 0
+        assert index.local_os_devices(0) == []
+
+
+def test_io_affinity_matrix() -> None:
+    path = os.path.join(os.path.dirname(normpath(__file__)), "sample_pci.xml")
+    with Topology.from_xml_file(path).set_io_types_filter(TypeFilter.KEEP_ALL) as topo:
+        matrix = topo.io_affinity_matrix(None)
+        names = [dev.name for dev in matrix.devices]
+        assert names == ["cuda0", "card0", "eth0", "nvme0n1", "nvme1n1"]
+        assert len(matrix) == 5
+
+        S, P, H, Y = (
+            IoPathKind.SAME_DEVICE,
+            IoPathKind.PCI_SWITCH,
+            IoPathKind.HOST_BRIDGE,
+            IoPathKind.SYSTEM,
+        )
+        assert matrix.path_kinds.tolist() == [
+            [S, S, P, Y, Y],
+            [S, S, P, Y, Y],
+            [P, P, S, Y, Y],
+            [Y, Y, Y, S, H],
+            [Y, Y, Y, H, S],
+        ]
+        # GPU -> switch -> host bridge -> package -> machine -> package -> host bridge
+        assert matrix.hops.tolist() == [
+            [0, 0, 1, 6, 6],
+            [0, 0, 1, 6, 6],
+            [1, 1, 0, 6, 6],
+            [6, 6, 6, 0, 1],
+            [6, 6, 6, 1, 0],
+        ]
+        assert matrix.ancestor_types[0, 2] == ObjType.BRIDGE
+        assert matrix.ancestor_types[0, 3] == ObjType.MACHINE
+        assert matrix.ancestor_types[0, 1] == ObjType.PCI_DEVICE
+
+        speed = matrix.linkspeed
+        assert speed[0, 1] == 0.0
+        assert speed[0, 2] == 12.0
+        assert speed[0, 3] == pytest.approx(7.877)
+        assert speed[3, 4] == pytest.approx(3.938)
+        assert speed.readonly
+
+        kinds = [ObjOsdevType.NETWORK, ObjOsdevType.STORAGE]
+        assert {d.name for d in topo.io_affinity_matrix(kinds).devices} <= set(names)
+        empty = topo.io_affinity_matrix([])
+        assert len(empty) == 0
+        assert empty.hops.tolist() == []
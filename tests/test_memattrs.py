@@ -2,13 +2,16 @@
 # SPDX-License-Identifier: BSD-3-Clause
 from __future__ import annotations
 
+import os
+
 import pytest
 
 from pyhwloc import from_this_system
 from pyhwloc.bitmap import Bitmap
+from pyhwloc.hwloc.lib import normpath
 from pyhwloc.hwobject import ObjType
 from pyhwloc.memattrs import MemAttrFlag, MemAttrId
-from pyhwloc.topology import TypeFilter
+from pyhwloc.topology import Topology, TypeFilter
 
 
 def test_get_memattrs() -> None:
@@ -132,3 +135,53 @@ def test_local_numa_nodes() -> None:
         assert isinstance(local_nodes, list)
         for node in local_nodes:
             assert node.type == ObjType.NUMANODE
+
+
+def test_memattr_table() -> None:
+    path = os.path.join(os.path.dirname(normpath(__file__)), "sample_numa.xml")
+    with Topology.from_xml_file(path) as topo:
+        memattrs = topo.get_memattrs()
+        attr = memattrs.register(
+            "bw", [MemAttrFlag.NEED_INITIATOR, MemAttrFlag.HIGHER_FIRST]
+        )
+        nodes = list(topo.iter_numa_nodes())
+        cpusets = [n.cpuset for n in nodes]
+        assert cpusets[0] is not None and cpusets[1] is not None
+        attr.set_value(nodes[0], 100, cpusets[0])
+        attr.set_value(nodes[1], 50, cpusets[0])
+        attr.set_value(nodes[1], 200, cpusets[1])
+
+        table = memattrs.build_table(["bw", MemAttrId.CAPACITY])
+        assert table.initiators == cpusets
+        assert table.targets == nodes
+        assert table.values("bw").tolist() == [[100, 50], [0, 200]]
+        capacity = table.values(MemAttrId.CAPACITY).tolist()
+        assert capacity[0] == capacity[1]
+        assert capacity[0] == [n.attr.local_memory for n in nodes]
+        with pytest.raises(ValueError, match="not in the table"):
+            table.values(MemAttrId.LATENCY)
+        with pytest.raises(ValueError, match="not in the table"):
+            table.values("Latency")
+        # By name or ID.
+        assert table.values("Capacity").tolist() == capacity
+        assert table.values(attr.native_handle.value).tolist() == [[100, 50], [0, 200]]
+
+        assert table.best_target(cpusets[0], "bw") == (nodes[0], 100)
+        assert table.best_target(cpusets[1], "bw") == (nodes[1], 200)
+        # Served from the cache.
+        assert table.best_target(cpusets[0], "bw") == (nodes[0], 100)
+
+        # Invalidated by `set_value`, objects are kept.
+        attr.set_value(nodes[1], 500, cpusets[0])
+        assert next(topo.iter_numa_nodes()) is nodes[0]
+        assert table.best_target(cpusets[0], "bw") == (nodes[1], 500)
+        assert table.values("bw").tolist() == [[100, 500], [0, 200]]
+
+        # Not a row, fall back to hwloc.
+        package = topo.get_obj_by_type(ObjType.PACKAGE, 0)
+        assert package is not None
+        attr.set_value(nodes[0], 300, package)
+        assert table.best_target(package, "bw") == (nodes[0], 300)
+
+        table = memattrs.build_table(["bw"], initiators=[package])
+        assert table.values("bw").tolist() == [[300, 0]]
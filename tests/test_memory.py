@@ -0,0 +1,203 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+from __future__ import annotations
+
+import mmap
+import os
+import pickle
+
+import pytest
+
+from pyhwloc import Topology
+from pyhwloc.hwloc.lib import normpath
+from pyhwloc.memory import (
+    MemBindPool,
+    MigrationStats,
+    _size_class,
+    first_touch,
+    migrate_area,
+)
+from pyhwloc.topology import MemBindFlags, MemBindPolicy
+
+
+def test_alloc_membind() -> None:
+    with Topology() as topo:
+        node = next(topo.iter_numa_nodes())
+        buf = topo.alloc_membind(4096, node, MemBindPolicy.BIND)
+        assert len(buf) == buf.nbytes == 4096
+
+        view = buf.as_memoryview()
+        assert not view.readonly
+        view[:4] = b"abcd"
+        assert bytes(buf.as_memoryview()[:4]) == b"abcd"
+        assert buf.__array_interface__["shape"] == (4096,)
+
+        # Views are invalidated on release.
+        buf.release()
+        with pytest.raises(ValueError, match="released"):
+            view[0]
+        with pytest.raises(RuntimeError, match="released"):
+            buf.as_memoryview()
+        # No-op
+        buf.release()
+
+        nodeset = node.nodeset
+        assert nodeset is not None
+        buf = topo.alloc_membind(
+            128, nodeset, MemBindPolicy.BIND, MemBindFlags.BYNODESET
+        )
+        consumer = pickle.PickleBuffer(buf.as_memoryview())
+        with pytest.raises(RuntimeError, match="exported"):
+            buf.release()
+        consumer.release()
+        buf.release()
+
+        with pytest.raises(ValueError, match="positive"):
+            topo.alloc_membind(0, node, MemBindPolicy.BIND)
+
+        # Released along with the topology.
+        buf = topo.alloc_membind(128, topo.cpuset, MemBindPolicy.BIND)
+        view = buf.as_memoryview()
+    with pytest.raises(ValueError, match="released"):
+        view[0]
+
+
+def test_membind_pool() -> None:
+    with Topology() as topo:
+        node = next(topo.iter_numa_nodes())
+        pool = MemBindPool(topo, max_cached_bytes=1 << 20)
+        buf = pool.alloc(1000, node)
+        addr = buf.address
+        assert buf.nbytes == 1000
+        buf.release()
+        assert pool.cached_bytes > 0
+
+        # Same size class and NUMA node, the block is reused.
+        buf = pool.alloc(1024, node)
+        assert buf.address == addr
+        assert pool.cached_bytes == 0
+        buf.release()
+
+        # Blocks exceeding the limit are freed.
+        big = pool.alloc(2 << 20, node)
+        big.release()
+        assert pool.cached_bytes < 2 << 20
+
+        pool.clear()
+        assert pool.cached_bytes == 0
+
+        buf = pool.alloc(1000, node)
+        pool.release()
+        with pytest.raises(RuntimeError, match="released"):
+            pool.alloc(1000, node)
+        # Freed directly after the pool is released.
+        buf.release()
+        assert pool.cached_bytes == 0
+
+        pool = MemBindPool(topo)
+        buf = pool.alloc(1000, node)
+        buf.as_memoryview()[0] = 1
+    # The topology releases both the buffer and the pool.
+    assert pool.cached_bytes == 0
+
+
+def test_first_touch() -> None:
+    with Topology() as topo:
+        nbytes = 64 * mmap.PAGESIZE + 3
+        # Don't write to the buffer, the pages are allocated by `first_touch`.
+        buf = topo.alloc_membind(nbytes, topo.cpuset, MemBindPolicy.FIRSTTOUCH)
+        nodes = [
+            n for n in topo.iter_numa_nodes() if n.cpuset and not n.cpuset.is_zero()
+        ]
+        try:
+            locations = first_touch(topo, buf, verify=True)
+        except (NotImplementedError, OSError):
+            buf.release()
+            pytest.skip("Memory location is not supported.")
+        assert len(locations) == len(nodes)
+        # Each range is allocated on the node that touched it.
+        for node, loc in zip(nodes, locations):
+            assert node.nodeset is not None
+            assert not loc.is_zero() and loc.is_included(node.nodeset)
+        assert bytes(buf.as_memoryview()) == b"\x00" * nbytes
+
+        view = buf.as_memoryview()
+        view[:] = b"\xff" * nbytes
+        del view
+        assert first_touch(topo, buf) == []
+        assert bytes(buf.as_memoryview()) == b"\x00" * nbytes
+
+        with pytest.raises(ValueError, match="NUMA"):
+            first_touch(topo, buf, nodes=[])
+        buf.release()
+
+    with Topology.from_xml_file(
+        os.path.join(os.path.dirname(normpath(__file__)), "sample_numa.xml")
+    ) as topo:
+        nodes = list(topo.iter_numa_nodes())
+        assert len(nodes) == 2
+        # Not this system, the allocation falls back to an unbound one and the thread
+        # binding failures are only logged.
+        buf = topo.alloc_membind(3 * mmap.PAGESIZE, nodes[0], MemBindPolicy.BIND)
+        assert first_touch(topo, buf, nodes) == []
+        assert bytes(buf.as_memoryview()) == b"\x00" * buf.nbytes
+        buf.release()
+
+
+def test_migrate_area() -> None:
+    with Topology() as topo:
+        node = next(topo.iter_numa_nodes())
+        nbytes = 5 * mmap.PAGESIZE + 100
+        buf = topo.alloc_membind(nbytes, node, MemBindPolicy.BIND)
+        buf.as_memoryview()[:] = b"\x01" * nbytes
+
+        reports: list[MigrationStats] = []
+        stats = migrate_area(
+            topo, buf, node, chunk_bytes=2 * mmap.PAGESIZE, progress=reports.append
+        )
+        assert stats.n_chunks == 3 and stats.done_chunks == 3
+        assert stats.migrated_bytes == nbytes and stats.skipped_bytes == 0
+        assert stats.throughput >= 0
+        assert [r.done_chunks for r in reports] == [1, 2, 3]
+        assert bytes(buf.as_memoryview()) == b"\x01" * nbytes
+
+        # Everything is already local.
+        nodeset = node.nodeset
+        assert nodeset is not None
+        try:
+            stats = migrate_area(
+                topo, buf.as_memoryview(), nodeset, parallel=False, only_remote=True
+            )
+        except (NotImplementedError, OSError):
+            pass
+        else:
+            assert stats.n_chunks == 1 and stats.skipped_bytes == nbytes
+
+        with pytest.raises(ValueError, match="positive"):
+            migrate_area(topo, buf, node, chunk_bytes=0)
+        with pytest.raises(ValueError, match="Empty"):
+            migrate_area(topo, buf, set())
+        buf.release()
+
+        pool = MemBindPool(topo)
+        buf = pool.alloc(mmap.PAGESIZE, node)
+        assert buf.migrate(node, parallel=False).n_chunks == 1
+        buf.release()
+        # Not returned to the pool.
+        assert pool.cached_bytes == 0
+        pool.release()
+
+
+def test_size_class() -> None:
+    page = mmap.PAGESIZE
+    assert _size_class(1) == page
+    assert _size_class(page + 1) == 2 * page
+    assert _size_class(2 << 20) == 2 << 20
+    # Quarter steps between powers of two for large requests.
+    assert _size_class((2 << 20) + 1) == (2 << 20) + (512 << 10)
+    gib = 1 << 30
+    assert _size_class(4 * gib + 100 * (1 << 20)) == 5 * gib
+    for nbytes in (3 << 20, 5 * gib + 1, 7 * gib - 1, 8 * gib):
+        size = _size_class(nbytes)
+        assert size % page == 0
+        assert nbytes <= size < nbytes * 1.25 + page
@@ -0,0 +1,101 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+from __future__ import annotations
+
+import mmap
+import os
+import threading
+import time
+
+import pytest
+
+from pyhwloc import Topology
+from pyhwloc.topology import MemBindPolicy
+
+
+def test_monitor() -> None:
+    with Topology() as topo:
+        monitor = topo.placement_monitor(capacity=4)
+        assert monitor.stats().n_samples == 0
+        assert monitor.samples().nbytes == 0
+
+        monitor.watch_process(os.getpid())
+        key = monitor.watch_thread(threading.current_thread())
+        for _ in range(6):
+            monitor.sample()
+        assert monitor.n_samples == 6
+
+        samples = monitor.samples()
+        n_nodes = topo.n_numa_nodes()
+        assert samples.shape == (4, 6 + 3 * n_nodes)
+        # Oldest first.
+        times = [samples[i, 0] for i in range(4)]
+        assert times == sorted(times)
+
+        stats = monitor.stats()
+        assert stats.n_samples == 4 and stats.duration >= 0
+        assert len(stats.nodes) == n_nodes
+        # Both tasks are seen in each sample, within their binding.
+        assert sum(n.tasks for n in stats.nodes) == 8
+        assert stats.violations == 0
+        assert monitor.stats(window=2).n_samples == 2
+        with pytest.raises(ValueError):
+            monitor.stats(window=0)
+
+        # A PU outside of the expected cpuset.
+        monitor.unwatch(key)
+        with pytest.raises(KeyError):
+            monitor.unwatch(key)
+        pu = topo.get_last_cpu_location()
+        others = topo.cpuset - pu
+        monitor.watch_thread(threading.get_native_id(), others)
+        monitor.sample()
+        assert monitor.stats(window=1).violations <= 1
+
+        # An exited thread is skipped.
+        thread = threading.Thread(target=lambda: None)
+        thread.start()
+        monitor.watch_thread(thread)
+        thread.join()
+        monitor.sample()
+        monitor.close()
+        assert "n_tasks=0" in repr(monitor)
+
+        with pytest.raises(ValueError):
+            topo.placement_monitor(interval=0)
+
+
+def test_monitor_buffer() -> None:
+    with Topology() as topo:
+        node = next(topo.iter_numa_nodes())
+        buf = topo.alloc_membind(4 * mmap.PAGESIZE, node, MemBindPolicy.BIND)
+        buf.as_memoryview()[:] = b"\x01" * buf.nbytes
+        monitor = topo.placement_monitor()
+        key = monitor.watch_buffer(buf.as_memoryview(), {node.os_index}, n_probes=2)
+        try:
+            monitor.sample()
+        except (NotImplementedError, OSError):
+            pytest.skip("Memory location is not supported.")
+        stats = monitor.stats()
+        assert stats.pages <= 2
+        assert stats.remote_pages == 0 and stats.remote_fraction == 0.0
+        assert sum(n.pages for n in stats.nodes) == stats.pages
+
+        monitor.unwatch(key)
+        buf.release()
+        with pytest.raises(ValueError):
+            monitor.watch_buffer(bytearray(8), n_probes=0)
+
+
+def test_monitor_thread() -> None:
+    with Topology() as topo:
+        with topo.placement_monitor(interval=0.01) as monitor:
+            assert monitor.is_running
+            monitor.watch_thread(threading.current_thread())
+            with pytest.raises(RuntimeError):
+                monitor.start()
+            deadline = time.monotonic() + 5
+            while monitor.n_samples < 2 and time.monotonic() < deadline:
+                time.sleep(0.01)
+            assert monitor.n_samples >= 2
+        assert not monitor.is_running
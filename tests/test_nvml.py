@@ -61,3 +61,21 @@ def test_with_nvml_cpu_affinity() -> None:
             assert dev.get_affinity() == aff
     finally:
         nm.nvmlShutdown()
+
+
+def test_get_all_devices() -> None:
+    try:
+        nm.nvmlInit()
+        with Topology.from_this_system().set_io_types_filter(
+            TypeFilter.KEEP_ALL
+        ) as topo:
+            table = hwloc_nvml.get_all_devices(topo)
+            assert len(table) == nm.nvmlDeviceGetCount()
+            for i, loc in enumerate(table):
+                dev = hwloc_nvml.get_device(topo, i)
+                assert loc.index == i
+                assert loc.cpuset == dev.get_affinity()
+                assert loc.osdev == dev.get_osdev()
+            assert hwloc_nvml.get_all_devices(topo) == table
+    finally:
+        nm.nvmlShutdown()
@@ -0,0 +1,110 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+from __future__ import annotations
+
+import os
+import tempfile
+
+import pytest
+
+from pyhwloc.bitmap import Bitmap
+from pyhwloc.store import TopologyStore, shape_key
+from pyhwloc.topology import AllowFlags, Topology, TopologyFlags
+
+DESC = "pack:2 core:4 pu:2"
+
+
+def _node(desc: str, host: str) -> Topology:
+    topo = Topology.from_synthetic(desc).set_flags(TopologyFlags.INCLUDE_DISALLOWED)
+    topo.load()
+    topo.get_root_obj().add_info("HostName", host)
+    return topo
+
+
+def test_shape_key() -> None:
+    with _node(DESC, "a") as a, _node(DESC, "b") as b, _node("pack:1 pu:2", "c") as c:
+        assert shape_key(a) == shape_key(b)
+        assert shape_key(a) != shape_key(c)
+        allowed = Bitmap.from_sched_set({0, 1})
+        b.allow(allowed, None, AllowFlags.CUSTOM)
+        b.refresh()
+        assert shape_key(a) == shape_key(b)
+
+    # Asymmetric topologies don't have a synthetic description.
+    cpuset = Bitmap.from_sched_set({0, 1, 2})
+    with Topology.from_synthetic("pack:2 core:2 pu:1", load=True) as a:
+        with Topology.from_synthetic("pack:2 core:2 pu:1", load=True) as b:
+            key = shape_key(a)
+            a.restrict(cpuset, 0)
+            b.restrict(cpuset, 0)
+            assert shape_key(a) == shape_key(b) != key
+
+
+def test_store() -> None:
+    with TopologyStore() as store:
+        for i in range(4):
+            with _node(DESC, f"node{i}") as topo:
+                if i == 3:
+                    topo.allow(
+                        Bitmap.from_sched_set({0, 1, 2, 3}), None, AllowFlags.CUSTOM
+                    )
+                    topo.refresh()
+                key = store.add(f"node{i}", topo)
+        with _node("pack:1 core:2 pu:1", "small") as topo:
+            other = store.add("small", topo)
+        assert key != other
+
+        assert len(store) == 5 and store.n_shapes == 2
+        assert list(store) == ["node0", "node1", "node2", "node3", "small"]
+        assert "node1" in store and "node9" not in store
+        shapes = store.shapes()
+        assert shapes[key] == ["node0", "node1", "node2", "node3"]
+        assert shapes[other] == ["small"]
+
+        shared = store.topology("node2")
+        assert shared is store.topology("node0")
+        assert shared.is_loaded and shared.n_cpus() == 16
+        assert store.info("node2")["HostName"] == "node2"
+        assert store.info("small")["HostName"] == "small"
+        assert store.allowed_cpuset("node0").weight() == 16
+        assert store.allowed_cpuset("node3").to_sched_set() == {0, 1, 2, 3}
+        assert store.allowed_nodeset("node3") == shared.allowed_nodeset
+        assert store.view("node3").n_cores() == 2
+        assert store.view("node1").n_cores() == 8
+
+        # Replace a node.
+        with _node("pack:1 core:2 pu:1", "node1") as topo:
+            assert store.add("node1", topo) == other
+        assert store.shape_of("node1") == other
+        assert store.info("node1")["HostName"] == "node1"
+
+        small = store.topology("small")
+        store.remove("small")
+        store.remove("node1")
+        assert store.n_shapes == 1
+        assert not small.is_loaded
+        with pytest.raises(KeyError):
+            store.remove("small")
+        with pytest.raises(KeyError):
+            store.topology("small")
+    assert len(store) == 0 and not shared.is_loaded
+
+
+def test_store_xml_dir() -> None:
+    with tempfile.TemporaryDirectory() as tmpdir:
+        for i in range(5):
+            desc = DESC if i % 2 == 0 else "pack:1 core:2 pu:2"
+            with _node(desc, f"node{i}") as topo:
+                topo.export_xml_file(os.path.join(tmpdir, f"node{i}.xml"))
+
+        with TopologyStore() as store:
+            store.add_xml_dir(
+                tmpdir, flags=TopologyFlags.INCLUDE_DISALLOWED, batch_size=2
+            )
+            assert list(store) == [f"node{i}" for i in range(5)]
+            assert store.n_shapes == 2
+            assert store.topology("node4").n_cpus() == 16
+            assert store.topology("node3").n_cpus() == 4
+            assert store.info("node4")["HostName"] == "node4"
+            with pytest.raises(ValueError):
+                store.add_xml_dir(tmpdir, batch_size=0)
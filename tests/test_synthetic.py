@@ -0,0 +1,68 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+from __future__ import annotations
+
+import pytest
+
+from pyhwloc.hwobject import ObjType
+from pyhwloc.synthetic import PRESETS, SyntheticShape
+from pyhwloc.topology import Topology
+
+
+@pytest.mark.parametrize("name", list(PRESETS))
+def test_presets(name: str) -> None:
+    shape = PRESETS[name]
+    with shape.load() as topo:
+        assert topo.n_cpus() == shape.n_pus
+        assert topo.n_cores() == shape.n_cores
+        assert topo.n_numa_nodes() == shape.n_numa_nodes
+        assert topo.get_nbobjs_by_type(ObjType.PACKAGE) == shape.n_packages
+
+        (dist,) = topo.get_distances()
+        try:
+            n = dist.nbobjs
+            assert n == shape.n_numa_nodes
+            for i in range(n):
+                assert dist[i, i] == 10
+                for j in range(i + 1, n):
+                    assert dist[i, j] == dist[j, i] > 10
+        finally:
+            dist.release()
+
+
+def test_shape() -> None:
+    shape = SyntheticShape(
+        packages=2, numa_per_package=2, cxl_per_package=1, cores=2, pus=1, memory=4096
+    )
+    assert shape.n_numa_nodes == 6 and shape.n_pus == 8
+    with shape.load() as topo:
+        nodes = list(topo.iter_numa_nodes())
+        # Memory-only nodes cover the package.
+        cxl = [n for n in nodes if n.local_memory != 4096]
+        assert len(cxl) == 2
+        assert [n.cpuset.weight() for n in cxl] == [4, 4]
+
+    scaled = shape.scaled(4)
+    assert scaled.n_pus == 4 * shape.n_pus and scaled.packages == 8
+
+    shape = SyntheticShape(groups=(2, 3), packages=2, cores=3, caches=False)
+    assert shape.description() == (
+        "group:2 group:3 pack:2 [numa(memory=17179869184)] core:3 pu:2"
+    )
+    with shape.load(distances=False) as topo:
+        assert topo.n_cpus() == 72
+        groups = [o for o in topo.iter_all_breadth_first() if o.is_group()]
+        assert len(groups) == 8
+        assert topo.get_distances() == []
+
+    with Topology.from_synthetic(shape.description(), load=True) as topo:
+        assert topo.n_cpus() == shape.n_pus
+
+    with pytest.raises(ValueError):
+        SyntheticShape(packages=0)
+    with pytest.raises(ValueError):
+        SyntheticShape(groups=(2, 0))
+    with pytest.raises(ValueError):
+        SyntheticShape(cxl_per_package=-1)
+    with pytest.raises(ValueError):
+        shape.scaled(0)
@@ -2,24 +2,30 @@
 # SPDX-License-Identifier: BSD-3-Clause
 from __future__ import annotations
 
+import asyncio
 import copy
+import mmap
 import os
 import pickle
 import platform
+import tempfile
+from typing import Any
 
 import pytest
 
 from pyhwloc.bitmap import Bitmap
 from pyhwloc.hwloc.lib import normpath
-from pyhwloc.hwobject import Bridge, ObjType, OsDevice, PciDevice
+from pyhwloc.hwobject import Bridge, GetTypeDepth, ObjType, OsDevice, PciDevice
 from pyhwloc.topology import (
     AllowFlags,
+    CpuBindFlags,
     ExportXmlFlags,
     RestrictFlags,
     Topology,
     TopologyFlags,
     TypeFilter,
 )
+from pyhwloc.utils import PciId
 
 
 def test_context_manager_current_system() -> None:
@@ -190,6 +196,73 @@ def run_pickling(original: Topology) -> None:
             restored.destroy()
 
 
+def test_xml_buffer_types() -> None:
+    with Topology.from_synthetic("node:2 core:2 pu:2", load=True) as topo:
+        xml_buffer = topo.export_xml_buffer(0)
+    encoded = xml_buffer.encode("utf-8")
+
+    for buf in (
+        xml_buffer,
+        encoded,
+        bytearray(encoded),
+        memoryview(encoded),
+        # Not the complete object.
+        memoryview(b"  " + encoded)[2:],
+    ):
+        with Topology.from_xml_buffer(buf, load=True) as topo:
+            assert topo.n_cpus() == 8
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        path = os.path.join(tmpdir, "topo.xml")
+        with open(path, "wb") as fd:
+            fd.write(encoded)
+        with open(path, "rb") as fd:
+            with mmap.mmap(fd.fileno(), 0, access=mmap.ACCESS_READ) as buf:
+                with Topology.from_xml_buffer(buf, load=True) as topo:
+                    assert topo.n_cpus() == 8
+                # hwloc doesn't hold the buffer.
+                buf.close()
+
+    with pytest.raises(BufferError):
+        Topology.from_xml_buffer(memoryview(encoded)[::2])
+    with pytest.raises(ValueError):
+        Topology.from_xml_buffer(b"<topology>", load=True)
+
+
+def test_from_xml_files() -> None:
+    descs = ["node:1 core:2 pu:1", "node:2 core:2 pu:2", "pack:2 core:4 pu:1"]
+    with tempfile.TemporaryDirectory() as tmpdir:
+        paths = []
+        for i, desc in enumerate(descs):
+            with Topology.from_synthetic(desc, load=True) as topo:
+                paths.append(os.path.join(tmpdir, f"node{i}.xml"))
+                topo.export_xml_file(paths[-1])
+        with open(os.path.join(tmpdir, "notes.txt"), "w") as fd:
+            fd.write("not a topology")
+
+        topos = Topology.from_xml_files(paths, max_workers=2)
+        try:
+            assert [t.n_cpus() for t in topos] == [2, 8, 8]
+            assert all(t.is_loaded for t in topos)
+        finally:
+            for t in topos:
+                t.destroy()
+
+        nodes = Topology.from_xml_dir(tmpdir)
+        try:
+            assert list(nodes) == ["node0", "node1", "node2"]
+            with Topology.from_synthetic(descs[2], load=True) as topo:
+                expected = topo.export_synthetic(0)
+            assert nodes["node2"].export_synthetic(0) == expected
+        finally:
+            for t in nodes.values():
+                t.destroy()
+
+        assert Topology.from_xml_dir(tmpdir, "*.json") == {}
+        with pytest.raises(ValueError):
+            Topology.from_xml_dir(tmpdir, "*")
+
+
 def test_pickle_current_system() -> None:
     original = Topology()
     try:
@@ -213,6 +286,53 @@ def test_pickle_foreign() -> None:
             topo.destroy()
 
 
+def test_pickle_memoized() -> None:
+    with Topology.from_synthetic("node:2 core:2 pu:2") as topo:
+        state = topo.__getstate__()
+        assert topo.__getstate__()["xml_buffer"] is state["xml_buffer"]
+        restored = pickle.loads(pickle.dumps(topo))
+        try:
+            # The restored topology reuses the XML from the pickle.
+            assert restored.__getstate__()["xml_buffer"] is restored._xml_memo
+            assert restored.export_synthetic(0) == topo.export_synthetic(0)
+        finally:
+            restored.destroy()
+
+        # Modifying the topology resets the memo.
+        topo.get_root_obj().add_info("Foo", "Bar")
+        xml_buffer = topo.__getstate__()["xml_buffer"]
+        assert xml_buffer is not state["xml_buffer"]
+        assert "Foo" in xml_buffer
+        topo.restrict(Bitmap.from_sched_set({0, 1}), 0)
+        restored = pickle.loads(pickle.dumps(topo))
+        try:
+            assert restored.n_cpus() == 2
+        finally:
+            restored.destroy()
+
+
+def test_pickle_strip_io() -> None:
+    path = os.path.join(os.path.dirname(normpath(__file__)), "sample_osdev.xml")
+    with Topology.from_xml_file(path).set_io_types_filter(TypeFilter.KEEP_ALL) as topo:
+        assert topo.n_os_devices() > 0
+        n_cpus = topo.n_cpus()
+        full = pickle.dumps(topo)
+        stripped = pickle.dumps(topo.set_pickle_options(strip_io=True))
+        assert len(stripped) < len(full)
+        # The topology itself is unchanged.
+        assert topo.n_os_devices() > 0
+
+    restored = pickle.loads(stripped)
+    try:
+        assert restored.n_os_devices() == 0
+        assert restored.n_pci_devices() == 0
+        assert restored.n_cpus() == n_cpus
+        # The option is preserved.
+        assert pickle.loads(pickle.dumps(restored)).n_os_devices() == 0
+    finally:
+        restored.destroy()
+
+
 def test_pickle_unloaded_topology() -> None:
     topo = Topology()
     topo.destroy()  # Make it unloaded
@@ -330,6 +450,41 @@ def test_object_iteration() -> None:
         assert len(all_objects) == len(depth_objects)
 
 
+def test_snapshot_level() -> None:
+    desc = "pack:2 core:2 pu:2"
+
+    with Topology.from_synthetic(desc) as topo:
+        pu_depth = topo.depth - 1
+        snapshot = topo.snapshot_level(pu_depth)
+        assert len(snapshot) == topo.n_cpus() == 8
+        assert snapshot.obj_type == ObjType.PU
+        for i, pu in enumerate(topo.iter_cpus()):
+            assert snapshot.os_index[i] == pu.os_index
+            assert snapshot.logical_index[i] == pu.logical_index
+            assert snapshot.gp_index[i] == pu.gp_index
+            assert pu.parent is not None
+            assert snapshot.parent_gp_index[i] == pu.parent.gp_index
+            assert pu.cpuset is not None
+            assert snapshot.cpuset_first[i] == snapshot.cpuset_last[i] == pu.os_index
+            assert snapshot.cpuset_weight[i] == 1
+            assert snapshot.nodeset_first[i] == 0
+
+        mv = memoryview(snapshot.os_index)
+        assert mv.tolist() == list(range(8))
+
+        snapshot = topo.snapshot_level(0)
+        assert len(snapshot) == 1
+        assert snapshot.parent_gp_index[0] == 2**64 - 1
+        assert snapshot.cpuset_weight[0] == 8
+
+        snapshot = topo.snapshot_level(GetTypeDepth.NUMANODE)
+        assert len(snapshot) == 1
+        assert snapshot.obj_type == ObjType.NUMANODE
+
+        snapshot = topo.snapshot_level(GetTypeDepth.OS_DEVICE)
+        assert len(snapshot) == 0
+
+
 def test_find_io_devices() -> None:
     sample_osdev_path = os.path.join(
         os.path.dirname(normpath(__file__)), "sample_osdev.xml"
@@ -399,7 +554,217 @@ def test_topology_allow() -> None:
             topo.allow(cpuset, None, AllowFlags.ALL)
 
         topo.allow(cpuset, None, AllowFlags.CUSTOM)
+        pu = topo.get_obj_by_type(ObjType.PU, 0)
         topo.refresh()
+        # The tree is unchanged, objects are kept.
+        assert topo.get_obj_by_type(ObjType.PU, 0) is pu
 
         assert topo.allowed_cpuset.weight() == 1
         assert topo.allowed_nodeset.weight() == 2
+
+
+def test_refresh_allowed() -> None:
+    with Topology.from_this_system().set_flags(
+        TopologyFlags.INCLUDE_DISALLOWED
+    ) as topo:
+        allowed_cpuset = topo.allowed_cpuset
+        root = topo.get_root_obj()
+        assert not topo.refresh_allowed()
+
+        pu = topo.get_obj_by_type(ObjType.PU, 0)
+        assert pu is not None
+        cpuset = pu.cpuset
+        assert cpuset is not None
+        topo.allow(cpuset, None, AllowFlags.CUSTOM)
+        assert topo.allowed_cpuset == cpuset
+        # Objects are kept, only the allowed sets are re-read.
+        assert topo.refresh_allowed() == (cpuset != allowed_cpuset)
+        assert topo.allowed_cpuset == allowed_cpuset
+        assert topo.get_root_obj() is root
+        assert topo.get_obj_by_type(ObjType.PU, 0) is pu
+
+    with Topology() as topo:
+        with pytest.raises(ValueError, match="INCLUDE_DISALLOWED"):
+            topo.refresh_allowed()
+
+
+def test_async_load() -> None:
+    async def load() -> tuple[Topology, Topology]:
+        topo = await Topology.from_this_system_async()
+        assert topo.is_loaded
+        filtered = Topology.from_this_system().set_io_types_filter(TypeFilter.KEEP_ALL)
+        assert await filtered.aload() is filtered
+        # No-op
+        await filtered.aload()
+        return topo, filtered
+
+    topo, filtered = asyncio.run(load())
+    with topo, filtered:
+        assert topo.n_cpus() == filtered.n_cpus() > 0
+        assert filtered.n_pci_devices() >= topo.n_pci_devices()
+
+
+def test_from_this_system_staged() -> None:
+    topo, future = Topology.from_this_system_staged(TypeFilter.KEEP_ALL)
+    with topo:
+        assert topo.n_cores() > 0
+        assert topo.n_pci_devices() == 0
+        assert topo.n_os_devices() == 0
+        with future.result() as full:
+            assert full.n_cpus() == topo.n_cpus()
+            assert full.get_root_obj().arity == topo.get_root_obj().arity
+
+
+def test_from_this_system_staged_error(monkeypatch: pytest.MonkeyPatch) -> None:
+    loaded = []
+    load = Topology.load
+    set_io_types_filter = Topology.set_io_types_filter
+
+    def load_recorded(self: Topology) -> Topology:
+        loaded.append(load(self))
+        return self
+
+    def failing_filter(self: Topology, filter: TypeFilter) -> Topology:
+        if filter == TypeFilter.KEEP_NONE:
+            raise RuntimeError("first pass")
+        return set_io_types_filter(self, filter)
+
+    monkeypatch.setattr(Topology, "load", load_recorded)
+    monkeypatch.setattr(Topology, "set_io_types_filter", failing_filter)
+    with pytest.raises(RuntimeError, match="first pass"):
+        Topology.from_this_system_staged()
+    # The background topology is destroyed if it has been loaded.
+    assert all(not t.is_loaded for t in loaded)
+
+
+def test_from_cached_system(monkeypatch: pytest.MonkeyPatch) -> None:
+    with tempfile.TemporaryDirectory() as tmpdir:
+        with Topology.from_cached_system(tmpdir) as topo:
+            assert topo.is_this_system()
+            cpuset = topo.cpuset
+            n_cpus = topo.n_cpus()
+        files = os.listdir(tmpdir)
+        assert len(files) == 1 and files[0].endswith(".xml")
+        path = os.path.join(tmpdir, files[0])
+        with open(path, "r") as fd:
+            content = fd.read()
+        # The cache is written to a temporary file then moved in place.
+        inode = os.stat(path).st_ino
+
+        # Served from the cache.
+        with Topology.from_cached_system(tmpdir) as topo:
+            assert topo.is_this_system()
+            assert topo.cpuset == cpuset
+            assert topo.n_cpus() == n_cpus
+        assert os.stat(path).st_ino == inode
+        with open(path, "r") as fd:
+            assert fd.read() == content
+
+        with Topology.from_this_system(load=True) as topo:
+            assert topo.cpuset == cpuset
+
+        # A corrupted cache is replaced.
+        with open(path, "w") as fd:
+            fd.write(content[: len(content) // 2])
+        with Topology.from_cached_system(tmpdir) as topo:
+            assert topo.cpuset == cpuset
+        with open(path, "r") as fd:
+            assert fd.read() == content
+        assert os.stat(path).st_ino != inode
+        inode = os.stat(path).st_ino
+
+        # A cache missing the CPUs this process runs on is replaced.
+        if hasattr(os, "sched_getaffinity"):
+            with monkeypatch.context() as m:
+                m.setattr(os, "sched_getaffinity", lambda pid: {4096})
+                with Topology.from_cached_system(tmpdir) as topo:
+                    assert topo.cpuset == cpuset
+            assert os.stat(path).st_ino != inode
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        with Topology.from_cached_system(
+            tmpdir, io_types_filter=TypeFilter.KEEP_ALL
+        ) as topo:
+            n_pci = topo.n_pci_devices()
+        with Topology.from_cached_system(tmpdir) as topo:
+            assert topo.n_pci_devices() == 0
+        assert len(os.listdir(tmpdir)) == 2
+        with Topology.from_cached_system(
+            tmpdir, io_types_filter=TypeFilter.KEEP_ALL
+        ) as topo:
+            assert topo.n_pci_devices() == n_pci
+
+
+def test_distribute() -> None:
+    with Topology.from_synthetic("pack:2 core:4 pu:2") as topo:
+        plan = topo.distribute(4)
+        assert len(plan) == 4
+        cpusets = plan.cpusets
+        # One item for each half of a package.
+        assert [str(c) for c in cpusets] == ["0-3", "4-7", "8-11", "12-15"]
+        cpuset, nodeset = plan[0]
+        assert cpuset == cpusets[0]
+        assert nodeset == plan.nodesets[0]
+        assert not nodeset.is_zero()
+
+        plan = topo.distribute(2, until=ObjType.CORE, reverse=True)
+        assert [str(c) for c in plan.cpusets] == ["8-15", "0-7"]
+
+        packages = list(topo.iter_packages())
+        plan = topo.distribute(2, roots=packages[1:])
+        assert [str(c) for c in plan.cpusets] == ["8-11", "12-15"]
+
+        plan = topo.distribute(16, max_per_core=2)
+        assert all(c.weight() == 1 for c in plan.cpusets)
+        with pytest.raises(ValueError, match="per core"):
+            topo.distribute(17, max_per_core=2)
+        with pytest.raises(ValueError, match="positive"):
+            topo.distribute(0)
+
+        with pytest.raises(ValueError, match="processes"):
+            plan.bind_procs(list(range(17)))
+
+
+def test_placement_plan_bind() -> None:
+    with Topology() as topo:
+        if not topo.get_support().cpubind.set_thisthread_cpubind:
+            pytest.skip("Thread binding is not supported.")
+        orig = topo.get_cpubind(CpuBindFlags.THREAD)
+        plan = topo.distribute(1)
+        try:
+            plan.bind_current_thread(0, policy=None)
+            assert topo.get_cpubind(CpuBindFlags.THREAD) == plan.cpusets[0]
+        finally:
+            topo.set_cpubind(orig, CpuBindFlags.THREAD)
+
+
+def test_get_all_devices_cache() -> None:
+    calls = []
+
+    def fill(
+        hdl: Any, n: int, cpusets: Any, nodesets: Any, pci_ids: Any, osdevs: Any
+    ) -> None:
+        calls.append(n)
+        for i in range(n):
+            Bitmap.from_native_handle(cpusets[i], own=False).set(i)
+            Bitmap.from_native_handle(nodesets[i], own=False).set(0)
+            pci_ids[3 * i : 3 * i + 3] = [0, i, 0]
+
+    with Topology.from_synthetic("node:2 core:2 pu:2") as topo:
+        table = topo._get_all_devices("fake", lambda: 2, fill)
+        assert [d.cpuset.to_sched_set() for d in table] == [{0}, {1}]
+        assert [d.pci_id for d in table] == [PciId(0, 0, 0), PciId(0, 1, 0)]
+        assert all(d.osdev is None for d in table)
+
+        table[0].cpuset.set(5)
+        assert topo._get_all_devices("fake", lambda: 2, fill)[0].cpuset.weight() == 1
+        assert calls == [2]
+
+        # Kept when only the attributes are modified.
+        topo.get_root_obj().add_info("Foo", "Bar")
+        topo._get_all_devices("fake", lambda: 2, fill)
+        assert calls == [2]
+
+        topo.restrict(Bitmap.from_sched_set({0, 1}), 0)
+        topo._get_all_devices("fake", lambda: 2, fill)
+        assert calls == [2, 2]
@@ -0,0 +1,67 @@
+# Copyright (c) 2025, NVIDIA CORPORATION.
+# SPDX-License-Identifier: BSD-3-Clause
+from __future__ import annotations
+
+import os
+
+import pytest
+
+from pyhwloc.bitmap import Bitmap
+from pyhwloc.hwloc.lib import normpath
+from pyhwloc.hwobject import ObjType
+from pyhwloc.topology import Topology
+
+
+def test_topology_view() -> None:
+    with Topology.from_synthetic("pack:2 numa:1 core:2 pu:2") as topo:
+        view = topo.view({0, 1, 2, 3})
+        assert view.n_cpus() == 4
+        assert view.n_cores() == 2
+        assert view.n_numa_nodes() == 1
+        assert view.get_nbobjs_by_type(ObjType.PACKAGE) == 1
+        assert view.nodeset == Bitmap.from_sched_set({0})
+        # The topology is not modified.
+        assert topo.n_cores() == 4
+
+        cores = list(view.iter_cores())
+        assert cores == list(topo.iter_cores())[:2]
+        # Objects are shared with the topology.
+        assert cores[0] is topo.get_obj_by_type(ObjType.CORE, 0)
+        assert view.get_obj_by_type(ObjType.CORE, 1) is cores[1]
+        assert view.get_obj_by_type(ObjType.CORE, 2) is None
+        (pkg,) = view.get_largest_objs()
+        assert pkg.type == ObjType.PACKAGE and pkg.logical_index == 0
+
+        # Logical indices are relative to the view.
+        view = topo.view({5, 6, 7})
+        assert [pu.os_index for pu in view.iter_cpus()] == [5, 6, 7]
+        core = topo.get_obj_by_type(ObjType.CORE, 3)
+        assert core is not None and core in view
+        assert view.get_obj_index(core) == 0
+        assert view.n_cores() == 1
+        assert view.n_numa_nodes() == 0
+        assert [o.type for o in view.get_largest_objs()] == [ObjType.PU, ObjType.CORE]
+        pu = topo.get_obj_by_type(ObjType.PU, 0)
+        assert pu is not None and pu not in view
+        assert view.get_obj_index(pu) == -1
+
+        assert topo.view(set()).n_cpus() == 0
+
+    with pytest.raises(RuntimeError, match="invalid"):
+        view.n_cpus()
+
+
+def test_topology_view_distances() -> None:
+    path = os.path.join(os.path.dirname(normpath(__file__)), "sample_numa.xml")
+    with Topology.from_xml_file(path) as topo:
+        (dist,) = topo.view(topo.cpuset).get_distances()
+        assert dist.name == "NUMALatency"
+        assert dist.values.tolist() == [[10, 21], [21, 10]]
+
+        pkg = topo.get_obj_by_type(ObjType.PACKAGE, 1)
+        assert pkg is not None and pkg.cpuset is not None
+        (dist,) = topo.view(pkg.cpuset).get_distances()
+        assert dist.objects == list(topo.iter_numa_nodes())[1:]
+        assert dist.values.tolist() == [[10]]
+
+        assert topo.view({1000}).get_distances() == []